@@ -0,0 +1,361 @@
+#include <sokol/sokol_app.h>
+#include <sokol/sokol_time.h>
+
+#include "frame.hpp"
+#include "mesh.hpp"
+#include "model.hpp"
+#include "bvh.hpp"
+#include "pvs.hpp"
+#include "impostor.hpp"
+#include "frustum_culling.h"
+
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+//NOTE: headless culling checks, synthetic scenes are culled by every path engine has and compared
+//with brute force reference, anything reference sees and a path culled is false negative and fails.
+//Sokol app entry calls sokol_main before it opens window, checks run there and exit.
+
+static int gFailures = 0;
+
+static void check(bool condition, const char* what, size_t count) {
+    if (!condition) {
+        std::printf("FAIL: %s (%zu)\n", what, count);
+        gFailures++;
+    }
+}
+
+static std::vector<PortalFrustum> createFrusta(const glm::vec3& eye) {
+    const auto proj = glm::perspectiveLH(glm::radians(65.0f), 16.0f / 9.0f, 1.0f, 2000.0f);
+    const glm::vec3 dirs[] = { { 0, 0, 1 }, { 1, 0, 0 }, { -0.7f, 0.3f, -0.7f }, { 0.2f, -0.5f, 0.8f } };
+
+    std::vector<PortalFrustum> frusta;
+    for (const auto& dir : dirs) {
+        Frustum frustum;
+        frustum.update(proj * glm::lookAtLH(eye, eye + glm::normalize(dir), glm::vec3(0.0f, 1.0f, 0.0f)));
+
+        PortalFrustum portalFrustum;
+        portalFrustum.set(frustum);
+        frusta.push_back(portalFrustum);
+    }
+
+    return frusta;
+}
+
+static bool isAabbVisible(const PortalFrustum& frustum, const std::pair<glm::vec3, glm::vec3>& box) {
+    uint32_t mask = UINT32_MAX;
+    return frustum.checkAabbMasked(box.first, box.second, mask);
+}
+
+static bool isMaskSet(const std::vector<uint32_t>& mask, size_t i) {
+    return (mask[i / 32] >> (i % 32)) & 1;
+}
+
+//NOTE: SoA batch tests of every SIMD level against per object test
+static void runSimdCull(const PortalFrustum& frustum, const glm::vec3& center) {
+    constexpr size_t ObjectCount = 100000;
+    constexpr int Iterations = 20;
+    constexpr float WorldSize = 4000.0f;
+
+    std::mt19937 random(1337);
+    std::uniform_real_distribution<float> offset(-WorldSize * 0.5f, WorldSize * 0.5f);
+    std::uniform_real_distribution<float> size(0.5f, 10.0f);
+
+    BoundsSoA bounds;
+    bounds.resize(ObjectCount);
+    std::vector<std::pair<glm::vec3, glm::vec3>> boxes(ObjectCount);
+    for (size_t i = 0; i < ObjectCount; i++) {
+        const auto position = center + glm::vec3(offset(random), offset(random) * 0.05f, offset(random));
+        const glm::vec3 halfSize(size(random), size(random), size(random));
+        boxes[i] = { position - halfSize, position + halfSize };
+        bounds.set(i, boxes[i].first, boxes[i].second);
+    }
+
+    const SimdLevel levels[] = { SimdLevel::SCALAR, SimdLevel::SSE, SimdLevel::AVX };
+    constexpr const char* names[] = { "scalar", "SSE", "AVX" };
+    std::vector<uint32_t> mask((ObjectCount + 31) / 32);
+    for (auto level : levels) {
+        if (level > PortalFrustum::getSimdLevel()) break;
+
+        const auto start = stm_now();
+        for (auto iteration = 0; iteration < Iterations; iteration++) {
+            frustum.checkAabbs(bounds, 0, ObjectCount, mask.data(), level);
+        }
+        const auto ms = stm_ms(stm_since(start)) / Iterations;
+
+        size_t visible = 0;
+        size_t missed = 0;
+        for (size_t i = 0; i < ObjectCount; i++) {
+            visible += isMaskSet(mask, i);
+            missed += isAabbVisible(frustum, boxes[i]) && !isMaskSet(mask, i);
+        }
+
+        std::printf("  AABB %s: %.3f ms, %zu visible\n", names[static_cast<int>(level)], ms, visible);
+        check(missed == 0, "SIMD AABB cull missed visible objects", missed);
+
+        //NOTE: sphere encloses box, everything box test passes has to pass too
+        frustum.checkSpheres(bounds, 0, ObjectCount, mask.data(), level);
+        missed = 0;
+        for (size_t i = 0; i < ObjectCount; i++) {
+            missed += isAabbVisible(frustum, boxes[i]) && !isMaskSet(mask, i);
+        }
+        check(missed == 0, "SIMD sphere cull missed visible objects", missed);
+    }
+}
+
+//NOTE: rotated poles, walls and crates, visible means sampled point of rotated box is in frustum
+static void runBoundsTest(const PortalFrustum& frustum, const glm::vec3& center) {
+    constexpr size_t FrameCount = 10000;
+    constexpr int Samples = 5;
+    constexpr float WorldSize = 1000.0f;
+
+    std::mt19937 random(1337);
+    std::uniform_real_distribution<float> offset(-WorldSize * 0.5f, WorldSize * 0.5f);
+    std::uniform_real_distribution<float> angle(0.0f, glm::two_pi<float>());
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    const std::pair<glm::vec3, glm::vec3> shapes[] = {
+        { glm::vec3(-0.2f, 0.0f, -0.2f), glm::vec3(0.2f, 12.0f, 0.2f) },
+        { glm::vec3(-10.0f, 0.0f, -0.2f), glm::vec3(10.0f, 4.0f, 0.2f) },
+        { glm::vec3(-1.0f, 0.0f, -1.0f), glm::vec3(1.0f, 2.0f, 1.0f) },
+    };
+
+    auto pointInside = [&](const glm::vec3& point) {
+        for (auto i = 0; i < frustum.planeCount; i++) {
+            if (glm::dot(glm::vec3(frustum.planes[i]), point) + frustum.planes[i].w < 0.0f) return false;
+        }
+        return true;
+    };
+
+    size_t visible = 0;
+    size_t sphereVisible = 0, sphereMissed = 0;
+    size_t aabbVisible = 0, aabbMissed = 0;
+    size_t orientedVisible = 0, orientedMissed = 0;
+    for (size_t i = 0; i < FrameCount; i++) {
+        Frame frame;
+        const auto& shape = shapes[i % 3];
+        frame.setBBOX(shape);
+        frame.setRot(glm::angleAxis(angle(random), glm::normalize(glm::vec3(unit(random), 1.0f, unit(random)))));
+        frame.setPos(center + glm::vec3(offset(random), offset(random) * 0.05f, offset(random)));
+
+        const auto& world = frame.getWorldMatrix();
+        bool isVisible = false;
+        for (auto x = 0; x < Samples && !isVisible; x++) {
+            for (auto y = 0; y < Samples && !isVisible; y++) {
+                for (auto z = 0; z < Samples && !isVisible; z++) {
+                    const auto t = glm::vec3(x, y, z) / static_cast<float>(Samples - 1);
+                    isVisible = pointInside(glm::vec3(world * glm::vec4(glm::mix(shape.first, shape.second, t), 1.0f)));
+                }
+            }
+        }
+
+        const bool isSphereVisible = frustum.checkSphere(frame.getSphere());
+        const bool isBoxVisible = isAabbVisible(frustum, frame.getWorldBBOX());
+        const bool isOrientedVisible = isBoxVisible && (frame.getOrientedBox() == nullptr || frustum.checkOrientedBox(frame.getOrientedBox()));
+
+        visible += isVisible;
+        sphereVisible += isSphereVisible;
+        sphereMissed += isVisible && !isSphereVisible;
+        aabbVisible += isBoxVisible;
+        aabbMissed += isVisible && !isBoxVisible;
+        orientedVisible += isOrientedVisible;
+        orientedMissed += isVisible && !isOrientedVisible;
+    }
+
+    std::printf("  %zu frames, %zu visible, passed: sphere %zu, AABB %zu, AABB + OBB %zu\n", FrameCount, visible, sphereVisible, aabbVisible, orientedVisible);
+    check(sphereMissed == 0, "sphere bounds culled visible frames", sphereMissed);
+    check(aabbMissed == 0, "AABB bounds culled visible frames", aabbMissed);
+    check(orientedMissed == 0, "oriented bounds culled visible frames", orientedMissed);
+}
+
+//NOTE: meshes in groups like city blocks, BVH cull and refit against test of every mesh
+static void runBvh(const PortalFrustum& frustum, const glm::vec3& center) {
+    constexpr size_t MeshCount = 50000;
+    constexpr size_t GroupSize = 100;
+    constexpr float WorldSize = 4000.0f;
+    constexpr int Iterations = 10;
+
+    std::mt19937 random(1337);
+    std::uniform_real_distribution<float> groupOffset(-WorldSize * 0.5f, WorldSize * 0.5f);
+    std::uniform_real_distribution<float> meshOffset(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> meshSize(0.5f, 5.0f);
+
+    auto root = std::make_shared<Frame>();
+    std::vector<Frame*> meshes;
+    meshes.reserve(MeshCount);
+    for (size_t created = 0; created < MeshCount;) {
+        auto group = std::make_shared<Model>();
+        group->setPos(center + glm::vec3(groupOffset(random), 0.0f, groupOffset(random)));
+        for (size_t i = 0; i < GroupSize && created < MeshCount; i++, created++) {
+            auto mesh = std::make_shared<Mesh>();
+            const glm::vec3 halfSize(meshSize(random), meshSize(random), meshSize(random));
+            mesh->setBBOX({ -halfSize, halfSize });
+            mesh->setPos({ meshOffset(random), meshOffset(random) * 0.1f, meshOffset(random) });
+            meshes.push_back(mesh.get());
+            group->addChild(std::move(mesh));
+        }
+        root->addChild(std::move(group));
+    }
+    root->invalidateTransformRecursively();
+
+    Bvh bvh;
+    auto start = stm_now();
+    bvh.build(meshes);
+    const auto buildMs = stm_ms(stm_since(start));
+
+    auto countMissed = [&](const FrameVector<Frame*>& visible) {
+        std::unordered_set<const Frame*> culled(visible.begin(), visible.end());
+        size_t missed = 0;
+        for (auto* mesh : meshes) {
+            missed += isAabbVisible(frustum, mesh->getWorldBBOX()) && culled.count(mesh) == 0;
+        }
+        return missed;
+    };
+
+    FrameVector<Frame*> visible;
+    visible.reserve(MeshCount);
+    start = stm_now();
+    for (auto iteration = 0; iteration < Iterations; iteration++) {
+        visible.clear();
+        bvh.cull(&frustum, 1, visible);
+    }
+    const auto cullMs = stm_ms(stm_since(start)) / Iterations;
+    check(countMissed(visible) == 0, "BVH cull missed visible meshes", countMissed(visible));
+
+    //NOTE: one percent of meshes moves, like animated or dragged objects would
+    for (size_t i = 0; i < meshes.size(); i += 100) {
+        meshes[i]->setPos(meshes[i]->getPos() + glm::vec3(meshOffset(random), 0.0f, meshOffset(random)));
+    }
+
+    start = stm_now();
+    bvh.refit();
+    const auto refitMs = stm_ms(stm_since(start));
+
+    visible.clear();
+    bvh.cull(&frustum, 1, visible);
+    check(countMissed(visible) == 0, "BVH cull after refit missed visible meshes", countMissed(visible));
+
+    std::printf("  %zu meshes: build %.3f ms, cull %.3f ms (%zu visible), refit %.3f ms\n", MeshCount, buildMs, cullMs, visible.size(), refitMs);
+    bvh.clear();
+}
+
+//NOTE: baked rows are trusted only with enough samples and have to survive cache round trip,
+//validation against portal culling needs loaded mission and stays in debug window
+static void runPvsCache() {
+    constexpr size_t SectorCount = 70;
+    constexpr size_t MeshCount = 200;
+
+    Pvs pvs;
+    pvs.reset(SectorCount, MeshCount, 42);
+    for (size_t row = 0; row < SectorCount; row++) {
+        for (uint32_t sample = 0; sample < row % (Pvs::MinRowSamples * 2); sample++) {
+            pvs.addSample(row);
+        }
+        pvs.markSector(row, row);
+        pvs.markSector(row, (row * 7) % SectorCount);
+        pvs.markMesh(row, (row * 13) % MeshCount);
+    }
+
+    size_t wrongRows = 0;
+    for (size_t row = 0; row < SectorCount; row++) {
+        wrongRows += pvs.hasRow(row) != (pvs.getSampleCount(row) >= Pvs::MinRowSamples);
+    }
+    check(wrongRows == 0, "PVS row used without enough samples", wrongRows);
+
+    const auto path = (std::filesystem::temp_directory_path() / "culling_bench.pvs").string();
+    Pvs loaded;
+    check(pvs.save(path) && loaded.load(path, 42), "PVS cache round trip failed", 0);
+    check(!Pvs().load(path, 43), "PVS cache loaded with different key", 0);
+    std::filesystem::remove(path);
+
+    size_t lost = 0;
+    for (size_t row = 0; row < SectorCount && loaded.isBaked(); row++) {
+        lost += loaded.hasRow(row) != pvs.hasRow(row);
+        for (size_t sector = 0; sector < SectorCount; sector++) {
+            lost += pvs.isSectorVisible(row, sector) && !loaded.isSectorVisible(row, sector);
+        }
+        for (size_t mesh = 0; mesh < MeshCount; mesh++) {
+            lost += pvs.isMeshVisible(row, mesh) && !loaded.isMeshVisible(row, mesh);
+        }
+    }
+    check(lost == 0, "PVS cache lost visible bits", lost);
+}
+
+//NOTE: impostor must show quad captured nearest to direction instance is seen from and
+//swap only for captured models, past distance widened or narrowed by lod hysteresis
+static void runImpostor(const glm::vec3& center) {
+    constexpr int Directions = 360;
+    const auto step = glm::two_pi<float>() / static_cast<float>(ImpostorAtlas::AngleCount);
+
+    ImpostorModel model;
+    for (int angle = 0; angle < ImpostorAtlas::AngleCount; angle++) {
+        model.faceGroups.push_back(std::make_unique<FaceGroup>(std::vector<uint16_t>(), std::weak_ptr<Mesh>()));
+    }
+
+    auto instance = std::make_shared<Model>();
+    instance->setPos(center);
+    instance->setRot(glm::angleAxis(0.7f, glm::vec3(0.0f, 1.0f, 0.0f)));
+    auto impostor = std::make_shared<Impostor>(&model);
+    impostor->setOwner(instance.get());
+    impostor->setPos({ 2.0f, 0.0f, -1.0f });
+
+    const auto position = glm::vec3(impostor->getWorldMatrix()[3]);
+    const auto toLocal = glm::inverse(glm::mat3(instance->getWorldMatrix()));
+    size_t wrongFaces = 0;
+    for (int i = 0; i < Directions; i++) {
+        const auto theta = glm::two_pi<float>() * static_cast<float>(i) / static_cast<float>(Directions);
+        const auto viewPos = position + glm::vec3(glm::sin(theta), 0.3f, glm::cos(theta)) * 200.0f;
+        const auto local = toLocal * (viewPos - position);
+
+        const auto* faceGroup = impostor->selectFaceGroup(viewPos);
+        int index = 0;
+        while (index < ImpostorAtlas::AngleCount && model.faceGroups[index].get() != faceGroup) index++;
+
+        //NOTE: capture of cell index looks from sin / cos of its angle in model space
+        const auto captured = glm::vec2(glm::sin(step * index), glm::cos(step * index));
+        const auto seen = glm::normalize(glm::vec2(local.x, local.z));
+        wrongFaces += glm::dot(captured, seen) < glm::cos(step * 0.5f) - 0.001f;
+    }
+    check(wrongFaces == 0, "impostor selected quad captured from far direction", wrongFaces);
+
+    const auto distance = ImpostorAtlas::getDistance();
+    const auto at = [&](float scale) { return position + glm::vec3(distance * scale, 0.0f, 0.0f); };
+    check(!impostor->isActive(at(2.0f), 1.0f), "impostor active before model was captured", 0);
+
+    model.isCaptured = true;
+    check(!impostor->isActive(at(1.05f), 1.0f), "impostor active inside lod hysteresis", 0);
+    check(impostor->isActive(at(1.2f), 1.0f), "impostor inactive past distance", 0);
+    check(impostor->isActive(at(0.95f), 1.0f), "impostor swapped back inside lod hysteresis", 0);
+    check(!impostor->isActive(at(0.8f), 1.0f), "impostor active inside distance", 0);
+}
+
+sapp_desc sokol_main(int argc, char* argv[]) {
+    (void)argc;
+    (void)argv;
+    stm_setup();
+
+    const glm::vec3 center(100.0f, 10.0f, -50.0f);
+    const auto frusta = createFrusta(center);
+    for (size_t i = 0; i < frusta.size(); i++) {
+        std::printf("view %zu\n", i);
+        runSimdCull(frusta[i], center);
+        runBoundsTest(frusta[i], center);
+        runBvh(frusta[i], center);
+    }
+
+    std::printf("PVS cache\n");
+    runPvsCache();
+
+    std::printf("impostor\n");
+    runImpostor(center);
+
+    std::printf(gFailures == 0 ? "culling bench passed\n" : "culling bench failed: %d checks\n", gFailures);
+    std::exit(gFailures == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+}
\ No newline at end of file
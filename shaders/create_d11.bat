@@ -1,2 +1,3 @@
 sokol-shdc.exe --input universal.glsl --output include/shader_universal.h --slang hlsl5
-sokol-shdc.exe --input debug.glsl --output include/shader_debug.h --slang hlsl5
\ No newline at end of file
+sokol-shdc.exe --input debug.glsl --output include/shader_debug.h --slang hlsl5
+sokol-shdc.exe --input oit.glsl --output include/shader_oit.h --slang hlsl5
\ No newline at end of file
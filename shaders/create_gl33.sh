@@ -1,2 +1,3 @@
 ./sokol-shdc --input universal.glsl --output include/shader_universal.h --slang glsl330
 ./sokol-shdc --input debug.glsl --output include/shader_debug.h --slang glsl330
+./sokol-shdc --input oit.glsl --output include/shader_oit.h --slang glsl330
@@ -0,0 +1,159 @@
+#pragma once
+/*
+    #version:1# (machine generated, don't edit!)
+
+    Generated by sokol-shdc (https://github.com/floooh/sokol-tools)
+
+    Cmdline: sokol-shdc --input oit.glsl --output include/shader_oit.h --slang glsl330
+
+    Overview:
+
+        Shader program 'composite':
+            Get shader desc: oit_composite_shader_desc(sg_query_backend());
+            Vertex shader: vs_composite
+                Attribute slots:
+                    ATTR_oit_vs_composite_aPos = 0
+            Fragment shader: fs_composite
+                Image 'accumTexture':
+                    Type: SG_IMAGETYPE_2D
+                    Component Type: SG_SAMPLERTYPE_FLOAT
+                    Bind slot: SLOT_oit_accumTexture = 0
+                Image 'revealTexture':
+                    Type: SG_IMAGETYPE_2D
+                    Component Type: SG_SAMPLERTYPE_FLOAT
+                    Bind slot: SLOT_oit_revealTexture = 1
+
+
+    Shader descriptor structs:
+
+        sg_shader composite = sg_make_shader(oit_composite_shader_desc(sg_query_backend()));
+
+    Vertex attribute locations for vertex shader 'vs_composite':
+
+        sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){
+            .layout = {
+                .attrs = {
+                    [ATTR_oit_vs_composite_aPos] = { ... },
+                },
+            },
+            ...});
+
+    Image bind slots, use as index in sg_bindings.vs_images[] or .fs_images[]
+
+        SLOT_oit_accumTexture = 0;
+        SLOT_oit_revealTexture = 1;
+
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stddef.h>
+#if !defined(SOKOL_SHDC_ALIGN)
+  #if defined(_MSC_VER)
+    #define SOKOL_SHDC_ALIGN(a) __declspec(align(a))
+  #else
+    #define SOKOL_SHDC_ALIGN(a) __attribute__((aligned(a)))
+  #endif
+#endif
+#define ATTR_oit_vs_composite_aPos (0)
+#define SLOT_oit_accumTexture (0)
+#define SLOT_oit_revealTexture (1)
+/*
+    #version 330
+    
+    layout(location = 0) in vec2 aPos;
+    
+    void main()
+    {
+        gl_Position = vec4(aPos, 0.0, 1.0);
+    }
+    
+*/
+static const char oit_vs_composite_source_glsl330[108] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x61,0x50,0x6f,0x73,0x3b,
+    0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x61,0x50,0x6f,0x73,0x2c,0x20,0x30,0x2e,0x30,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 330
+    
+    uniform sampler2D revealTexture;
+    uniform sampler2D accumTexture;
+    
+    layout(location = 0) out vec4 FragColor;
+    
+    void main()
+    {
+        ivec2 _14 = ivec2(gl_FragCoord.xy);
+        vec4 _25 = texelFetch(revealTexture, _14, 0);
+        float _26 = _25.x;
+        if (_26 >= 1.0)
+        {
+            discard;
+        }
+        vec4 _39 = texelFetch(accumTexture, _14, 0);
+        FragColor = vec4(_39.xyz / vec3(max(_39.w, 9.9999997473787516355514526367188e-06)), 1.0 - _26);
+    }
+    
+*/
+static const char oit_fs_composite_source_glsl330[451] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,
+    0x72,0x65,0x76,0x65,0x61,0x6c,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x3b,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,
+    0x20,0x61,0x63,0x63,0x75,0x6d,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x3b,0x0a,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x46,0x72,
+    0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,
+    0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,
+    0x32,0x20,0x5f,0x31,0x34,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x67,0x6c,
+    0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x32,0x35,0x20,0x3d,0x20,0x74,
+    0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x72,0x65,0x76,0x65,0x61,0x6c,
+    0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x2c,0x20,0x5f,0x31,0x34,0x2c,0x20,0x30,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x36,0x20,
+    0x3d,0x20,0x5f,0x32,0x35,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x5f,0x32,0x36,0x20,0x3e,0x3d,0x20,0x31,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,
+    0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x5f,0x33,0x39,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,
+    0x74,0x63,0x68,0x28,0x61,0x63,0x63,0x75,0x6d,0x54,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x2c,0x20,0x5f,0x31,0x34,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,
+    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,
+    0x5f,0x33,0x39,0x2e,0x78,0x79,0x7a,0x20,0x2f,0x20,0x76,0x65,0x63,0x33,0x28,0x6d,
+    0x61,0x78,0x28,0x5f,0x33,0x39,0x2e,0x77,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,
+    0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,0x35,0x35,
+    0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,0x36,0x29,
+    0x29,0x2c,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x5f,0x32,0x36,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x00,
+};
+#if !defined(SOKOL_GFX_INCLUDED)
+  #error "Please include sokol_gfx.h before shader_oit.h"
+#endif
+static inline const sg_shader_desc* oit_composite_shader_desc(sg_backend backend) {
+  if (backend == SG_BACKEND_GLCORE33) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.attrs[0].name = "aPos";
+      desc.vs.source = oit_vs_composite_source_glsl330;
+      desc.vs.entry = "main";
+      desc.fs.source = oit_fs_composite_source_glsl330;
+      desc.fs.entry = "main";
+      desc.fs.images[0].name = "accumTexture";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.fs.images[1].name = "revealTexture";
+      desc.fs.images[1].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[1].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "oit_composite_shader";
+    }
+    return &desc;
+  }
+  return 0;
+}
@@ -0,0 +1,33 @@
+@module oit
+@ctype vec2 glm::vec2
+
+//NOTE: resolves weighted blended transparency targets over opaque image
+@vs vs_composite
+in vec2 aPos;
+
+void main() {
+    gl_Position = vec4(aPos, 0.0, 1.0);
+}
+@end
+
+@fs fs_composite
+out vec4 FragColor;
+
+uniform sampler2D accumTexture;
+uniform sampler2D revealTexture;
+
+void main() {
+    ivec2 coord = ivec2(gl_FragCoord.xy);
+    float reveal = texelFetch(revealTexture, coord, 0).r;
+
+    //NOTE: nothing transparent covers this pixel
+    if(reveal >= 1.0)
+        discard;
+
+    vec4 accum = texelFetch(accumTexture, coord, 0);
+    vec3 average = accum.rgb / max(accum.a, 1e-5);
+    FragColor = vec4(average, 1.0 - reveal);
+}
+@end
+
+@program composite vs_composite fs_composite
\ No newline at end of file
@@ -4,12 +4,26 @@
 @ctype vec3 glm::vec3
 @ctype vec4 glm::vec4
 
-@vs vs
+//NOTE: shader variants are compiled from same source, features are
+//selected by defines instead of runtime flags:
+//  SKINNED     - bone palette skinning
+//  BILLBOARD   - camera facing quads
+//  ENV         - environment map blending
+//NOTE: billboards never use env maps, there is no billboard_env program
+@block vs_main
 in vec3 aPos;
 in vec3 aNormal;
 in vec2 aTexCoord;
+#if SKINNED
 in vec2 aIndexes;
 in vec2 aWeights;
+#endif
+
+/* per instance section, model matrix comes from instance buffer */
+in vec4 aModel0;
+in vec4 aModel1;
+in vec4 aModel2;
+in vec4 aModel3;
 
 out vec3 FragPos;
 out vec3 Norm;  
@@ -17,25 +31,24 @@ out vec2 TexCoord;
 out vec3 Env;
 out vec3 ViewDir;
 out vec4 ViewSpace;
-out vec3 Light;
+out vec3 LightAmbient;
+out vec3 LightDiffuse;
 out vec4 Fog;
 
-/* material section */
-struct material_t {
-    vec3 ambient;
-    vec3 diffuse;
-    vec3 specular;
+/* per frame section, changes only with camera or layer */
+//NOTE: view has translation removed on CPU for things next to camera
+uniform vs_frame {
+    mat4 view;
+    mat4 projection;
+    vec3 viewPos;
+    vec4 fogColor;
+    vec2 fogRange;
 };
 
-uniform vs_material {
-    vec4 ambient;
-    vec4 diffuse;
-    vec4 emissive;
-} material;
-
-material_t getMaterial();
-
-/* --------------- */
+/* per object section, shared by all instances of draw */
+uniform vs_object {
+    float lightsCount;
+};
 
 /* lights section */
 #define NUM_LIGHTS 15
@@ -68,29 +81,26 @@ uniform vs_lights {
 } lights;
 
 light_t getLight(int index);
-vec3 computeLight(light_t light, vec3 normal, vec3 fragPos, vec3 viewDir, material_t mat);
+vec3 computeLight(light_t light, vec3 normal, vec3 fragPos, vec3 viewDir);
+float getFogFactor(float d, float FogMin, float FogMax);
 
 /* --------------- */
-/* --------------- */
+/* skinning section, only in skinned variant */
+#if SKINNED
 #define NUM_BONES  20
 
-uniform vs_params {
-    mat4 model;
-    mat4 view;
-    mat4 projection;
+uniform vs_bones {
     mat4 bones[NUM_BONES];
-    vec3 viewPos;
-    float billboard;
-    float relative;
-    float lightsCount;
-    float bonesCount;
 };
+#endif
 
 void main() {
+    mat4 model = mat4(aModel0, aModel1, aModel2, aModel3);
     vec3 newVertex = aPos;
     vec3 newNormal = aNormal;
 
-    if(int(bonesCount) > 0) {
+#if SKINNED
+    {
         newVertex = vec3(0.0, 0.0, 0.0);
         mat4 bone1 = bones[int(aIndexes.x)];
         mat4 bone2 = bones[int(aIndexes.y)];
@@ -102,6 +112,7 @@ void main() {
         newNormal += (bone1 * vec4(aNormal, 0.0)).xyz * aWeights.x;
         newNormal += (bone2 * vec4(aNormal, 0.0)).xyz * aWeights.y;
     }
+#endif
 
     FragPos = vec3(model * vec4(newVertex, 1.0));
     ViewDir = normalize(FragPos - viewPos);
@@ -109,49 +120,44 @@ void main() {
     Norm = normalize(mat3(transpose(inverse(model))) * newNormal);  
     TexCoord = aTexCoord;
 
-    //NOTE: calculate light
+    //NOTE: calculate fog, range is zero when fog is disabled
     Fog = vec4(0.0);
+    if(fogRange.y > 0.0) {
+        Fog = vec4(fogColor.xyz, getFogFactor(length(FragPos - viewPos), fogRange.x, fogRange.y));
+    }
 
-    vec3 light = vec3(0.0);
-    material_t mat = getMaterial();
+    //NOTE: calculate light, material diffuse color is applied in fragment stage
+    vec3 ambient = vec3(0.0);
+    vec3 diffuse = vec3(0.0);
     for(int i = 0; i < int(lightsCount); i++) {
-        light += computeLight(getLight(i), Norm, FragPos, ViewDir, mat);
+        light_t light = getLight(i);
+        if(light.type == LightType_Ambient) {
+            ambient += light.ambient;
+        } else {
+            diffuse += computeLight(light, Norm, FragPos, ViewDir);
+        }
     }
 
-    Light = light;
-
-    //NOTE: reset view pos ( for relative things next to camera )
-    //used for skybox
-    mat4 viewMat = view;
-    if(int(relative) > 0) {
-        viewMat[3] = vec4(0.0, 0.0, 0.0, 1.0);
-    }
+    LightAmbient = ambient;
+    LightDiffuse = diffuse;
 
     //NOTE: billboarding
     //TODO: lock specific axis
-    mat4 modelView = viewMat * model;
-    if(int(billboard) > 0) {
-        modelView[0][0] = length(vec3(model[0]));
-        modelView[0][1] = 0.0; 
-        modelView[0][2] = 0.0; 
-
-        modelView[2][0] = 0.0; 
-        modelView[2][1] = 0.0; 
-        modelView[2][2] = 1.0; 
-    }
+    mat4 modelView = view * model;
+#if BILLBOARD
+    modelView[0][0] = length(vec3(model[0]));
+    modelView[0][1] = 0.0; 
+    modelView[0][2] = 0.0; 
+
+    modelView[2][0] = 0.0; 
+    modelView[2][1] = 0.0; 
+    modelView[2][2] = 1.0; 
+#endif
     
     ViewSpace = modelView * vec4(newVertex, 1.0);
     gl_Position = projection * modelView * vec4(newVertex, 1.0);
 }
 
-material_t getMaterial() {
-    return material_t( 
-        material.ambient.xyz, 
-        material.diffuse.xyz,
-        material.emissive.xyz
-    );
-}
-
 light_t getLight(int index) {
     return light_t(
         int(lights.position[index].w),
@@ -170,15 +176,12 @@ float getFogFactor(float d, float FogMin, float FogMax) {
     return 1 - (FogMax - d) / (FogMax - FogMin);
 }
 
-vec3 computeLight(light_t light, vec3 normal, vec3 fragPos, vec3 viewDir, material_t mat) {
+vec3 computeLight(light_t light, vec3 normal, vec3 fragPos, vec3 viewDir) {
     switch(light.type) {
-        case LightType_Ambient: {
-            return light.ambient;
-        }
         case LightType_Dir: {
             vec3 lightDir = normalize(-light.dir);
             float intensity = clamp(dot(normalize(normal), normalize(lightDir)), 0.0, 1.0);
-            vec3 diffuse = (light.diffuse * (intensity * mat.diffuse));
+            vec3 diffuse = light.diffuse * intensity;
             return diffuse;
         }
         case LightType_Point: {
@@ -190,18 +193,13 @@ vec3 computeLight(light_t light, vec3 normal, vec3 fragPos, vec3 viewDir, materi
             else if(dist < light.range.y) dist = (dist - light.range.x) / (light.range.y - light.range.x) * -1.0 + 1.0;
             else dist = 0.0;
 
-            return light.diffuse * max(dot(lightVec, normalize(normal)), 0.0) * dist * mat.diffuse;
+            return light.diffuse * max(dot(lightVec, normalize(normal)), 0.0) * dist;
         }
         case LightType_Spot: {
             vec3 lightVec = (light.position - fragPos);
             float spot = acos(max(dot(lightVec, light.dir), 0.0));
             break;
         }
-        // case LightType_Fog: {
-        //     float len = length(FragPos - viewPos);
-        //     Fog = vec4(light.diffuse, getFogFactor(len, light.range.x, light.range.y));
-        //     return vec3(0.0);
-        // }
         default:
             return vec3(0.0);
     }
@@ -209,8 +207,13 @@ vec3 computeLight(light_t light, vec3 normal, vec3 fragPos, vec3 viewDir, materi
 
 @end
 
-@fs fs
+@block fs_main
+#if OIT
+layout(location = 0) out vec4 Accum;
+layout(location = 1) out vec4 Reveal;
+#else
 out vec4 FragColor;
+#endif
 
 in vec3 FragPos;
 in vec3 Norm;  
@@ -218,30 +221,59 @@ in vec2 TexCoord;
 in vec3 Env;
 in vec3 ViewDir;
 in vec4 ViewSpace;
-in vec3 Light;
+in vec3 LightAmbient;
+in vec3 LightDiffuse;
 in vec4 Fog;
 
-uniform fs_params {
+/* per material section */
+uniform fs_material {
+    vec4 ambient;
+    vec4 diffuse;
+    vec4 emissive;
     float envMode;
     float envRatio;
-};
+    float paletted;
+} material;
 
 uniform sampler2D diffuseSampler;
-uniform sampler2D envSampler;
 uniform sampler2D alphaSampler;
+uniform sampler2D paletteSampler;
+#if ENV
+uniform sampler2D envSampler;
+#endif
+
+//NOTE: paletted textures keep indices in R8 and colors in 256x1 palette,
+//indices can't be interpolated so bilinear filtering is done on palette colors
+vec4 fetchPaletted(ivec2 coord, ivec2 size) {
+    float index = texelFetch(diffuseSampler, (coord % size + size) % size, 0).r;
+    return texelFetch(paletteSampler, ivec2(int(index * 255.0 + 0.5), 0), 0);
+}
+
+vec4 samplePaletted(vec2 uv) {
+    ivec2 size = textureSize(diffuseSampler, 0);
+    vec2 texel = uv * vec2(size) - 0.5;
+    ivec2 base = ivec2(floor(texel));
+    vec2 f = fract(texel);
+
+    vec4 bottom = mix(fetchPaletted(base, size), fetchPaletted(base + ivec2(1, 0), size), f.x);
+    vec4 top = mix(fetchPaletted(base + ivec2(0, 1), size), fetchPaletted(base + ivec2(1, 1), size), f.x);
+    return mix(bottom, top, f.y);
+}
 
 void main() {
-    vec4 diffuseTexture = texture(diffuseSampler, TexCoord);
+    vec4 diffuseTexture = int(material.paletted) > 0 ? samplePaletted(TexCoord) : texture(diffuseSampler, TexCoord);
     vec4 alphaTexture = texture(alphaSampler, TexCoord);
 
     //NOTE: check for cutout
     if(diffuseTexture.a != 1.0)
         discard;
 
-    //TODO: check for alpha blending
-    vec4 lightDiffuse = vec4(Light, 1.0) * diffuseTexture.rgba;
-    lightDiffuse.a = ((alphaTexture.r + alphaTexture.g + alphaTexture.b) / 3.0);
+    //NOTE: alpha is used by blended pass only, material transparency rides in diffuse.a
+    vec3 light = LightAmbient + LightDiffuse * material.diffuse.xyz;
+    vec4 lightDiffuse = vec4(light, 1.0) * diffuseTexture.rgba;
+    lightDiffuse.a = ((alphaTexture.r + alphaTexture.g + alphaTexture.b) / 3.0) * material.diffuse.a;
 
+#if ENV
     //NOTE: check for env blending
     vec3 envUvStuff = normalize(vec3(Env.x, max((Env.y - 1.0) * 0.65 + 1.0, 0.0), Env.z));
     vec2 envUV = (envUvStuff.xz / (2.0 * (1.0 + envUvStuff.y))) + 0.5;
@@ -251,25 +283,88 @@ void main() {
     // 0 - ratio, 1 - mul, 2 - additiv, else disabled
     vec4 envBlended;
 
-    if(int(envMode) == 0) {
-        envBlended = mix(lightDiffuse, envTexture, envRatio);
-    } else if(int(envMode) == 1) {
+    if(int(material.envMode) == 0) {
+        envBlended = mix(lightDiffuse, envTexture, material.envRatio);
+    } else if(int(material.envMode) == 1) {
         envBlended = lightDiffuse * envTexture;
-    } else if(int(envMode) == 2) {
+    } else if(int(material.envMode) == 2) {
         envBlended = lightDiffuse + envTexture;
     } else {
         envBlended = lightDiffuse;
     }
+#else
+    vec4 envBlended = lightDiffuse;
+#endif
 
     //if you inverse color in glsl mix function you have to
     //put 1.0 - fogFactor
+    vec4 color = envBlended;
     if(length(Fog) > 0) {
-        FragColor = mix(envBlended, vec4(Fog.xyz, 1.0), Fog.w);
-    } else {
-        FragColor = envBlended;
+        color = mix(envBlended, vec4(Fog.xyz, 1.0), Fog.w);
     }
+
+#if OIT
+    //NOTE: weighted blended OIT ( McGuire, Bavoil 2013 ), weight favours near and opaque fragments,
+    //accumulated color is resolved against revealage in composite pass
+    float weight = clamp(pow(min(1.0, color.a * 10.0) + 0.01, 3.0) * 1e8 * pow(1.0 - gl_FragCoord.z * 0.9, 3.0), 1e-2, 3e3);
+    Accum = vec4(color.rgb * color.a, color.a) * weight;
+    Reveal = vec4(color.a);
+#else
+    FragColor = color;
+#endif
 }
 
 @end
 
-@program universal vs fs
\ No newline at end of file
+@vs vs_static
+#define SKINNED 0
+#define BILLBOARD 0
+@include_block vs_main
+@end
+
+@vs vs_skinned
+#define SKINNED 1
+#define BILLBOARD 0
+@include_block vs_main
+@end
+
+@vs vs_billboard
+#define SKINNED 0
+#define BILLBOARD 1
+@include_block vs_main
+@end
+
+@fs fs_diffuse
+#define ENV 0
+#define OIT 0
+@include_block fs_main
+@end
+
+@fs fs_env
+#define ENV 1
+#define OIT 0
+@include_block fs_main
+@end
+
+@fs fs_diffuse_oit
+#define ENV 0
+#define OIT 1
+@include_block fs_main
+@end
+
+@fs fs_env_oit
+#define ENV 1
+#define OIT 1
+@include_block fs_main
+@end
+
+@program static vs_static fs_diffuse
+@program static_env vs_static fs_env
+@program skinned vs_skinned fs_diffuse
+@program skinned_env vs_skinned fs_env
+@program billboard vs_billboard fs_diffuse
+@program static_oit vs_static fs_diffuse_oit
+@program static_env_oit vs_static fs_env_oit
+@program skinned_oit vs_skinned fs_diffuse_oit
+@program skinned_env_oit vs_skinned fs_env_oit
+@program billboard_oit vs_billboard fs_diffuse_oit
\ No newline at end of file
@@ -7,6 +7,9 @@
 #include "stats.hpp"
 #include "vfs.hpp"
 #include "audio.hpp"
+#include "material.hpp"
+
+#include <sokol/sokol_time.h>
 
 Stats gStats{};
 
@@ -33,7 +36,15 @@ void App::init() {
 
 void App::render() {
     mAudio->update();
-    
+    Texture::updateStreaming();
+
+    //NOTE: one clock read per frame drives every animated material
+    const auto timeMs = static_cast<uint64_t>(stm_ms(stm_now()));
+    Material::updateAnimations(timeMs);
+
+    //NOTE: impostor captures are own offscreen passes, they can't run inside frame pass
+    mScene->updateImpostors();
+
     Renderer::begin();
     mScene->render();
     Renderer::end();
@@ -1,4 +1,5 @@
 #include "bmp_loader.hpp"
+#include <algorithm>
 
 #define BI_RGB 0L
 #pragma pack(push, 1)
@@ -227,6 +228,51 @@ uint8_t* loadBMP(MFUtil::ScopedBuffer& file, int* w, int* h, bool useTransparenc
     return buffer;
 }
 
+uint8_t* loadIndexedBMP(MFUtil::ScopedBuffer& file, int* w, int* h, uint8_t* palette, bool useTransparencyKey) {
+    BITMAPFILEHEADER bmpFileHeader;
+    file.read((char*)&bmpFileHeader, sizeof(BITMAPFILEHEADER));
+
+    // NOTE: not valid BMP !
+    if (bmpFileHeader.bfType != 0x4D42) return nullptr;
+
+    BITMAPINFOHEADER bmmpInfoHeader;
+    file.read((char*)&bmmpInfoHeader, sizeof(BITMAPINFOHEADER));
+
+    // NOTE: only uncompressed 8 bit textures can stay indexed
+    if (bmmpInfoHeader.biCompression != BI_RGB || bmmpInfoHeader.biBitCount != 8)
+        return nullptr;
+
+    // NOTE: BMP rows are padded to 4 bytes and GL unpacks R8 rows with 4 byte alignment,
+    // indices are read and uploaded tightly packed so other widths stay on RGBA path
+    if (bmmpInfoHeader.biWidth % 4 != 0)
+        return nullptr;
+
+    RGBQUAD bmiColors[256]{};
+    const auto palleteSize = std::min<uint32_t>(bmmpInfoHeader.biClrUsed ? bmmpInfoHeader.biClrUsed : 256, 256);
+    file.read((char*)bmiColors, sizeof(RGBQUAD) * palleteSize);
+    file.seek(bmpFileHeader.bfOffBits);
+
+    // NOTE(DavoSK): mafia uses first key color in pallete in 8 bit texture as alpha
+    const RGBQUAD keyColor = bmiColors[0];
+    for (size_t i = 0, j = 0; i < 256; i++, j += 4) {
+        const auto& pixel = bmiColors[i];
+        palette[j] = pixel.rgbRed;
+        palette[j + 1] = pixel.rgbGreen;
+        palette[j + 2] = pixel.rgbBlue;
+        palette[j + 3] = useTransparencyKey &&
+                                 areColorSimilar(pixel.rgbBlue, pixel.rgbGreen, pixel.rgbRed, keyColor.rgbBlue, keyColor.rgbGreen, keyColor.rgbRed)
+                             ? 0
+                             : 255;
+    }
+
+    const auto indexedSize = bmmpInfoHeader.biWidth * bmmpInfoHeader.biHeight;
+    uint8_t* indices = new uint8_t[indexedSize];
+    file.read((char*)indices, indexedSize);
+
+    *w = bmmpInfoHeader.biWidth;
+    *h = bmmpInfoHeader.biHeight;
+    return indices;
+}
 
 uint8_t* loadBMPEx(const char* fileName, int* w, int* h, bool useTransparencyKey)  {
     std::ifstream inputFile(fileName, std::ifstream::binary);
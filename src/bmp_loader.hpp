@@ -5,4 +5,7 @@
 
 uint8_t* loadBMP(std::istream& file, int* w, int* h, bool useTransparencyKey = false);
 uint8_t* loadBMP(MFUtil::ScopedBuffer& buffer, int* w, int* h, bool useTransparencyKey = false);
+//NOTE: keeps 8 bit textures as palette indices, palette is expanded to 256 RGBA colors
+//with transparency key baked into alpha, returns nullptr for 24 bit textures
+uint8_t* loadIndexedBMP(MFUtil::ScopedBuffer& buffer, int* w, int* h, uint8_t* palette, bool useTransparencyKey = false);
 uint8_t* loadBMPEx(const char* fileName, int* w, int* h, bool useTransparencyKey = false);
\ No newline at end of file
@@ -1 +1,23 @@
-#include "bounding_volumes.hpp"
\ No newline at end of file
+#include "bounding_volumes.hpp"
+
+#include <limits>
+
+AABB getEmptyAABB() {
+	return { glm::vec3(std::numeric_limits<float>::max()), glm::vec3(std::numeric_limits<float>::lowest()) };
+}
+
+bool isEmptyAABB(const AABB& box) {
+	return box.first.x > box.second.x || box.first.y > box.second.y || box.first.z > box.second.z;
+}
+
+AABB transformAABB(const glm::mat4& matrix, const AABB& box) {
+	const auto center = glm::vec3(matrix * glm::vec4((box.first + box.second) * 0.5f, 1.0f));
+	const auto extent = (box.second - box.first) * 0.5f;
+
+	glm::vec3 worldExtent(0.0f);
+	for (auto column = 0; column < 3; column++) {
+		worldExtent += glm::abs(glm::vec3(matrix[column])) * extent[column];
+	}
+
+	return { center - worldExtent, center + worldExtent };
+}
\ No newline at end of file
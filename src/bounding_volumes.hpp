@@ -4,7 +4,24 @@
 #include <glm/gtc/matrix_transform.hpp> 
 #include <glm/gtx/quaternion.hpp>
 
+#include <utility>
+
 struct Sphere {
 	glm::vec3 center{ 0.f, 0.f, 0.f };
 	float radius{ 0.f };
-};
\ No newline at end of file
+};
+
+//NOTE: local box moved to world, axes are scaled by half extents
+struct OrientedBox {
+	glm::vec3 center{ 0.f, 0.f, 0.f };
+	glm::mat3 axes{ 1.f };
+};
+
+using AABB = std::pair<glm::vec3, glm::vec3>;
+
+//NOTE: box with min above max, merging anything into it gives that thing
+AABB getEmptyAABB();
+bool isEmptyAABB(const AABB& box);
+
+//NOTE: Arvo's method, exact AABB of transformed box without touching its 8 corners
+AABB transformAABB(const glm::mat4& matrix, const AABB& box);
\ No newline at end of file
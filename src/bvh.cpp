@@ -0,0 +1,294 @@
+#include "bvh.hpp"
+#include "frame.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <bit>
+
+static_assert(Bvh::MaxLeafSize <= 32, "leaf frames are culled into one mask word");
+
+enum class CullResult {
+    OUTSIDE,
+    INTERSECTING,
+    INSIDE
+};
+
+static std::pair<glm::vec3, glm::vec3> getFrameBounds(Frame* frame) {
+    return frame->getWorldBBOX();
+}
+
+static float getHalfArea(const glm::vec3& min, const glm::vec3& max) {
+    const auto extent = glm::max(max - min, glm::vec3(0.0f));
+    return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+}
+
+static CullResult classify(const PortalFrustum& frustum, const glm::vec3& min, const glm::vec3& max) {
+    auto result = CullResult::INSIDE;
+    for (auto i = 0; i < frustum.planeCount; i++) {
+        const auto& plane = frustum.planes[i];
+        const glm::vec3 normal(plane);
+        const auto positive = glm::mix(min, max, glm::greaterThanEqual(normal, glm::vec3(0.0f)));
+        const auto negative = glm::mix(max, min, glm::greaterThanEqual(normal, glm::vec3(0.0f)));
+
+        if (glm::dot(normal, positive) + plane.w < 0.0f) {
+            return CullResult::OUTSIDE;
+        }
+
+        if (glm::dot(normal, negative) + plane.w < 0.0f) {
+            result = CullResult::INTERSECTING;
+        }
+    }
+
+    return result;
+}
+
+Bvh::~Bvh() {
+    clear();
+}
+
+void Bvh::clear() {
+    for (auto* frame : mFrames) {
+        frame->setBvh(nullptr, InvalidIndex);
+    }
+
+    mNodes.clear();
+    mFrames.clear();
+    mBounds.resize(0);
+    mFrameLeaf.clear();
+    mDirty.clear();
+    mIsDirty.clear();
+}
+
+void Bvh::computeBounds(Node& node) const {
+    if (node.child != InvalidIndex) {
+        const auto& left = mNodes[node.child];
+        const auto& right = mNodes[node.child + 1];
+        node.min = glm::min(left.min, right.min);
+        node.max = glm::max(left.max, right.max);
+        return;
+    }
+
+    node.min = glm::vec3(std::numeric_limits<float>::max());
+    node.max = glm::vec3(std::numeric_limits<float>::lowest());
+    for (auto i = node.first; i < node.first + node.count; i++) {
+        node.min = glm::min(node.min, mBounds.getMin(i));
+        node.max = glm::max(node.max, mBounds.getMax(i));
+    }
+}
+
+void Bvh::build(std::vector<Frame*> frames) {
+    clear();
+    if (frames.empty()) return;
+
+    const auto frameCount = static_cast<uint32_t>(frames.size());
+    std::vector<glm::vec3> mins(frameCount), maxs(frameCount), centroids(frameCount);
+    std::vector<uint32_t> order(frameCount);
+    for (uint32_t i = 0; i < frameCount; i++) {
+        const auto bounds = getFrameBounds(frames[i]);
+        mins[i] = bounds.first;
+        maxs[i] = bounds.second;
+        centroids[i] = (bounds.first + bounds.second) * 0.5f;
+        order[i] = i;
+    }
+
+    //NOTE: node keeps its frame range even when inner, subtree fully inside frustum is taken at once
+    mNodes.reserve(frameCount * 2);
+    mNodes.push_back({ glm::vec3(0.0f), 0, glm::vec3(0.0f), frameCount, InvalidIndex, InvalidIndex });
+
+    struct Bin {
+        glm::vec3 min{ std::numeric_limits<float>::max() };
+        glm::vec3 max{ std::numeric_limits<float>::lowest() };
+        uint32_t count = 0;
+    };
+
+    std::vector<uint32_t> stack = { 0 };
+    while (!stack.empty()) {
+        const auto nodeIndex = stack.back();
+        stack.pop_back();
+
+        auto& node = mNodes[nodeIndex];
+        glm::vec3 centroidMin(std::numeric_limits<float>::max());
+        glm::vec3 centroidMax(std::numeric_limits<float>::lowest());
+        node.min = glm::vec3(std::numeric_limits<float>::max());
+        node.max = glm::vec3(std::numeric_limits<float>::lowest());
+        for (auto i = node.first; i < node.first + node.count; i++) {
+            const auto item = order[i];
+            node.min = glm::min(node.min, mins[item]);
+            node.max = glm::max(node.max, maxs[item]);
+            centroidMin = glm::min(centroidMin, centroids[item]);
+            centroidMax = glm::max(centroidMax, centroids[item]);
+        }
+
+        if (node.count <= MaxLeafSize) continue;
+
+        //NOTE: binned SAH, cost of split is sum of child areas weighted by their frame counts
+        auto bestCost = static_cast<float>(node.count) * getHalfArea(node.min, node.max);
+        auto bestAxis = -1;
+        auto bestSplit = 0;
+        for (auto axis = 0; axis < 3; axis++) {
+            const auto extent = centroidMax[axis] - centroidMin[axis];
+            if (extent <= 1e-5f) continue;
+
+            std::array<Bin, BinCount> bins;
+            const auto scale = static_cast<float>(BinCount) / extent;
+            for (auto i = node.first; i < node.first + node.count; i++) {
+                const auto item = order[i];
+                const auto bin = std::min(BinCount - 1, static_cast<int>((centroids[item][axis] - centroidMin[axis]) * scale));
+                bins[bin].min = glm::min(bins[bin].min, mins[item]);
+                bins[bin].max = glm::max(bins[bin].max, maxs[item]);
+                bins[bin].count++;
+            }
+
+            std::array<float, BinCount - 1> leftCosts;
+            Bin left;
+            for (auto i = 0; i < BinCount - 1; i++) {
+                left.min = glm::min(left.min, bins[i].min);
+                left.max = glm::max(left.max, bins[i].max);
+                left.count += bins[i].count;
+                leftCosts[i] = left.count > 0 ? static_cast<float>(left.count) * getHalfArea(left.min, left.max) : 0.0f;
+            }
+
+            Bin right;
+            for (auto i = BinCount - 1; i > 0; i--) {
+                right.min = glm::min(right.min, bins[i].min);
+                right.max = glm::max(right.max, bins[i].max);
+                right.count += bins[i].count;
+                const auto cost = leftCosts[i - 1] + (right.count > 0 ? static_cast<float>(right.count) * getHalfArea(right.min, right.max) : 0.0f);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestSplit = i;
+                }
+            }
+        }
+
+        if (bestAxis < 0) continue;
+
+        const auto scale = static_cast<float>(BinCount) / (centroidMax[bestAxis] - centroidMin[bestAxis]);
+        const auto begin = order.begin() + node.first;
+        const auto middle = std::partition(begin, begin + node.count, [&](uint32_t item) {
+            return std::min(BinCount - 1, static_cast<int>((centroids[item][bestAxis] - centroidMin[bestAxis]) * scale)) < bestSplit;
+        });
+
+        const auto leftCount = static_cast<uint32_t>(middle - begin);
+        if (leftCount == 0 || leftCount == node.count) continue;
+
+        const auto first = node.first;
+        const auto count = node.count;
+        const auto child = static_cast<uint32_t>(mNodes.size());
+        node.child = child;
+        mNodes.push_back({ glm::vec3(0.0f), first, glm::vec3(0.0f), leftCount, InvalidIndex, nodeIndex });
+        mNodes.push_back({ glm::vec3(0.0f), first + leftCount, glm::vec3(0.0f), count - leftCount, InvalidIndex, nodeIndex });
+        stack.push_back(child);
+        stack.push_back(child + 1);
+    }
+
+    mFrames.resize(frameCount);
+    mBounds.resize(frameCount);
+    mFrameLeaf.resize(frameCount);
+    mIsDirty.assign(frameCount, 0);
+    for (uint32_t i = 0; i < frameCount; i++) {
+        mFrames[i] = frames[order[i]];
+        mBounds.set(i, mins[order[i]], maxs[order[i]]);
+        mFrames[i]->setBvh(this, i);
+    }
+
+    for (uint32_t nodeIndex = 0; nodeIndex < mNodes.size(); nodeIndex++) {
+        const auto& node = mNodes[nodeIndex];
+        if (node.child != InvalidIndex) continue;
+        for (auto i = node.first; i < node.first + node.count; i++) {
+            mFrameLeaf[i] = nodeIndex;
+        }
+    }
+}
+
+void Bvh::markDirty(uint32_t frameIndex) {
+    if (frameIndex >= mIsDirty.size() || mIsDirty[frameIndex]) return;
+    mIsDirty[frameIndex] = 1;
+    mDirty.push_back(frameIndex);
+}
+
+uint32_t Bvh::refit() {
+    uint32_t refitLeaves = 0;
+    for (auto frameIndex : mDirty) {
+        mIsDirty[frameIndex] = 0;
+
+        const auto bounds = getFrameBounds(mFrames[frameIndex]);
+        mBounds.set(frameIndex, bounds.first, bounds.second);
+    }
+
+    //NOTE: parents stop growing once bounds did not change, shared paths are walked once
+    for (auto frameIndex : mDirty) {
+        auto nodeIndex = mFrameLeaf[frameIndex];
+        refitLeaves++;
+
+        while (nodeIndex != InvalidIndex) {
+            auto& node = mNodes[nodeIndex];
+            const auto min = node.min;
+            const auto max = node.max;
+            computeBounds(node);
+            if (node.min == min && node.max == max && nodeIndex != mFrameLeaf[frameIndex]) break;
+            nodeIndex = node.parent;
+        }
+    }
+
+    mDirty.clear();
+    return refitLeaves;
+}
+
+unsigned int Bvh::cull(const PortalFrustum* frusta, size_t count, FrameVector<Frame*>& visible) const {
+    if (mNodes.empty() || count == 0) return 0;
+    return cullNode(0, frusta, count, visible);
+}
+
+unsigned int Bvh::cullNode(uint32_t nodeIndex, const PortalFrustum* frusta, size_t count, FrameVector<Frame*>& visible) const {
+    const auto& node = mNodes[nodeIndex];
+
+    auto result = CullResult::OUTSIDE;
+    for (size_t i = 0; i < count && result != CullResult::INSIDE; i++) {
+        result = std::max(result, classify(frusta[i], node.min, node.max));
+    }
+
+    if (result == CullResult::OUTSIDE) return 1;
+
+    if (result == CullResult::INSIDE) {
+        visible.insert(visible.end(), mFrames.begin() + node.first, mFrames.begin() + node.first + node.count);
+        return 1;
+    }
+
+    //NOTE: leaf frames are tested at once from SoA bounds, MaxLeafSize fits one mask word
+    if (node.child == InvalidIndex) {
+        uint32_t leafMask = 0;
+        for (size_t f = 0; f < count; f++) {
+            uint32_t frustumMask = 0;
+            frusta[f].checkAabbs(mBounds, node.first, node.count, &frustumMask);
+            leafMask |= frustumMask;
+        }
+
+        //NOTE: thin rotated frames get second chance to be culled by their oriented box
+        if (Frame::isOrientedBoxesEnabled()) {
+            for (auto bits = leafMask; bits != 0; bits &= bits - 1) {
+                const auto bit = std::countr_zero(bits);
+                const auto* box = mFrames[node.first + bit]->getOrientedBox();
+                if (box == nullptr) continue;
+
+                bool isVisible = false;
+                for (size_t f = 0; f < count && !isVisible; f++) {
+                    isVisible = frusta[f].checkOrientedBox(box);
+                }
+
+                if (!isVisible) {
+                    leafMask &= ~(1u << bit);
+                }
+            }
+        }
+
+        for (; leafMask != 0; leafMask &= leafMask - 1) {
+            visible.push_back(mFrames[node.first + std::countr_zero(leafMask)]);
+        }
+        return 1;
+    }
+
+    return 1 + cullNode(node.child, frusta, count, visible) + cullNode(node.child + 1, frusta, count, visible);
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+
+#include "frame_arena.hpp"
+#include "frustum_culling.h"
+
+class Frame;
+
+//NOTE: bounding volume hierarchy over world AABBs of frames, built with binned SAH.
+//Frames which moved mark their leaf dirty, refit walks only from those leaves to root.
+class Bvh {
+public:
+    static constexpr uint32_t InvalidIndex = UINT32_MAX;
+    static constexpr uint32_t MaxLeafSize = 4;
+    static constexpr int BinCount = 16;
+
+    ~Bvh();
+
+    void build(std::vector<Frame*> frames);
+    void clear();
+
+    //NOTE: frame bounds changed, called from Frame::updateBoundingVolumes
+    void markDirty(uint32_t frameIndex);
+
+    //NOTE: refits dirty leaves and their parents, returns count of refit leaves
+    uint32_t refit();
+
+    //NOTE: appends frames touching any of frusta, subtrees fully inside one of them
+    //are taken without testing their frames, returns count of tested nodes
+    unsigned int cull(const PortalFrustum* frusta, size_t count, FrameVector<Frame*>& visible) const;
+
+    //NOTE: visits frames which world bounds contain point
+    template <typename Visitor>
+    void forEachContaining(const glm::vec3& point, Visitor&& visitor) const {
+        if (mNodes.empty()) return;
+
+        uint32_t stack[64];
+        int stackSize = 0;
+        stack[stackSize++] = 0;
+        while (stackSize > 0) {
+            const auto& node = mNodes[stack[--stackSize]];
+            if (glm::any(glm::lessThan(point, node.min)) || glm::any(glm::greaterThan(point, node.max))) continue;
+
+            if (node.child != InvalidIndex) {
+                stack[stackSize++] = node.child;
+                stack[stackSize++] = node.child + 1;
+                continue;
+            }
+
+            for (auto i = node.first; i < node.first + node.count; i++) {
+                visitor(mFrames[i]);
+            }
+        }
+    }
+
+    [[nodiscard]] size_t getNodeCount() const { return mNodes.size(); }
+    [[nodiscard]] size_t getFrameCount() const { return mFrames.size(); }
+private:
+    struct Node {
+        glm::vec3 min;
+        uint32_t first;
+        glm::vec3 max;
+        uint32_t count;
+        uint32_t child;
+        uint32_t parent;
+    };
+
+    void computeBounds(Node& node) const;
+    unsigned int cullNode(uint32_t nodeIndex, const PortalFrustum* frusta, size_t count, FrameVector<Frame*>& visible) const;
+
+    std::vector<Node> mNodes;
+    std::vector<Frame*> mFrames;
+    BoundsSoA mBounds;
+    std::vector<uint32_t> mFrameLeaf;
+    std::vector<uint32_t> mDirty;
+    std::vector<uint8_t> mIsDirty;
+};
\ No newline at end of file
@@ -4,14 +4,55 @@
 #include "app.hpp"
 #include "scene.hpp"
 #include "camera.hpp"
+#include "bvh.hpp"
 
 void Frame::render() {
     if (!mOn) return;
+
+    uint32_t parentMask;
+    if (!beginSubtree(parentMask)) return;
+    renderChilds();
+    endSubtree(parentMask);
+}
+
+void Frame::renderChilds() {
     for (auto& child : mChilds) {
         child->render();
     }
 }
 
+bool Frame::beginSubtree(uint32_t& parentMask) {
+    auto* scene = App::get()->getScene();
+    parentMask = scene->getCullMask();
+    return hasSubtreeUpdates() || scene->isSubtreeVisible(getSubtreeBounds());
+}
+
+void Frame::endSubtree(uint32_t parentMask) {
+    App::get()->getScene()->setCullMask(parentMask);
+}
+
+const std::pair<glm::vec3, glm::vec3>& Frame::getSubtreeBounds() {
+    if (!mIsSubtreeDirty) return mSubtreeBounds;
+
+    mSubtreeBounds = mABBBWorld;
+    mHasSubtreeUpdates = getFrameType() == FrameType::Sound;
+    for (const auto& child : mChilds) {
+        const auto& childBounds = child->getSubtreeBounds();
+        mSubtreeBounds.first = glm::min(mSubtreeBounds.first, childBounds.first);
+        mSubtreeBounds.second = glm::max(mSubtreeBounds.second, childBounds.second);
+        mHasSubtreeUpdates |= child->mHasSubtreeUpdates;
+    }
+
+    mIsSubtreeDirty = false;
+    return mSubtreeBounds;
+}
+
+void Frame::invalidateSubtreeBounds() {
+    for (auto* frame = this; frame != nullptr && !frame->mIsSubtreeDirty; frame = frame->mOwner) {
+        frame->mIsSubtreeDirty = true;
+    }
+}
+
 void Frame::debugRender() {
     if(!mOn) return;
     for (auto& child : mChilds) {
@@ -20,11 +61,13 @@ void Frame::debugRender() {
 }
 
 void Frame::addChild(std::shared_ptr<Frame> frame) {
+    invalidateSubtreeBounds();
     frame->setOwner(this);
     mChilds.push_back(std::move(frame));
 }
 
 void Frame::removeChild(std::shared_ptr<Frame> frame) {
+    invalidateSubtreeBounds();
     frame->setOwner(nullptr);
     mChilds.erase(std::remove(mChilds.begin(), mChilds.end(), frame), mChilds.end());
 }
@@ -47,41 +90,88 @@ const glm::mat4& Frame::getWorldMatrix() {
 void Frame::invalidateTransformRecursively() {
     invalidateTransform(); 
     const auto frameType = getFrameType();
-    glm::vec3 AABBmin = mAABB.first;
-	glm::vec3 AABBmax = mAABB.second;
 
+    //NOTE: rebuilt from own box each time, moved children don't leave it grown
+    auto bbox = mOwnAABB;
     for (auto frame : mChilds) {
         frame->invalidateTransformRecursively();
         
-        auto childBbox = frame->getBBOX();
-        const auto mat = frame->getMatrix();
-        glm::vec3 min = glm::translate(mat, childBbox.first)[3];
-        glm::vec3 max = glm::translate(mat, childBbox.second)[3];
+        const auto& childBbox = frame->getBBOX();
+        if (isEmptyAABB(childBbox)) continue;
 
-        AABBmin = glm::min(AABBmin, min);
-        AABBmax = glm::max(AABBmax, max);
+        const auto childBboxLocal = transformAABB(frame->getMatrix(), childBbox);
+        bbox.first = glm::min(bbox.first, childBboxLocal.first);
+        bbox.second = glm::max(bbox.second, childBboxLocal.second);
     }
 
     if(frameType == FrameType::Model || 
        frameType == FrameType::Mesh) {
-        setBBOX(std::make_pair(AABBmin, AABBmax));
-    } else {
-        updateBoundingVolumes();   
+        mAABB = isEmptyAABB(bbox) ? std::make_pair(glm::vec3(0.0f), glm::vec3(0.0f)) : bbox;
     }
+
+    updateBoundingVolumes();   
 }
 
 void Frame::setBBOX(const std::pair<glm::vec3, glm::vec3>& bbox) {
+    mOwnAABB = bbox;
     mAABB = bbox;
     updateBoundingVolumes();
 }
 
+static bool gOrientedBoxesEnabled = true;
+
+void Frame::setOrientedBoxesEnabled(bool enabled) {
+    gOrientedBoxesEnabled = enabled;
+}
+
+bool Frame::isOrientedBoxesEnabled() {
+    return gOrientedBoxesEnabled;
+}
+
 void Frame::updateBoundingVolumes() {
-    const auto mat = getWorldMatrix();
-    glm::vec3 min = glm::translate(mat, mAABB.first)[3];
-    glm::vec3 max = glm::translate(mat, mAABB.second)[3];
+    const auto& mat = getWorldMatrix();
+    mABBBWorld = transformAABB(mat, mAABB);
+
+    //NOTE: sphere around local box, radius is half diagonal scaled by largest axis scale
+    const auto center = (mAABB.first + mAABB.second) * 0.5f;
+    const auto extent = (mAABB.second - mAABB.first) * 0.5f;
+    const glm::mat3 axes(mat);
+    const auto scale = glm::max(glm::length(axes[0]), glm::max(glm::length(axes[1]), glm::length(axes[2])));
+    if (mSphereBounding == nullptr) {
+        mSphereBounding = std::make_unique<Sphere>();
+    }
+    mSphereBounding->center = glm::vec3(mat * glm::vec4(center, 1.0f));
+    mSphereBounding->radius = glm::length(extent) * scale;
+
+    //NOTE: keep oriented box only if it covers less than half of world box area
+    const glm::mat3 orientedAxes(axes[0] * extent.x, axes[1] * extent.y, axes[2] * extent.z);
+    const auto orientedArea = glm::length(orientedAxes[0]) * glm::length(orientedAxes[1]) + 
+                              glm::length(orientedAxes[1]) * glm::length(orientedAxes[2]) + 
+                              glm::length(orientedAxes[2]) * glm::length(orientedAxes[0]);
+    const auto worldExtent = (mABBBWorld.second - mABBBWorld.first) * 0.5f;
+    const auto worldArea = worldExtent.x * worldExtent.y + worldExtent.y * worldExtent.z + worldExtent.z * worldExtent.x;
+    if (orientedArea < worldArea * 0.5f) {
+        if (mOrientedBox == nullptr) {
+            mOrientedBox = std::make_unique<OrientedBox>();
+        }
+        mOrientedBox->center = mSphereBounding->center;
+        mOrientedBox->axes = orientedAxes;
+    } else {
+        mOrientedBox = nullptr;
+    }
+
+    if (mBvh != nullptr) {
+        mBvh->markDirty(mBvhIndex);
+    }
 
-    mABBBWorld = std::make_pair(min, max);
-    mSphereBounding = std::make_unique<Sphere>((mABBBWorld.second + mABBBWorld.first) * 0.5f, glm::length(mABBBWorld.first - mABBBWorld.second));
+    invalidateSubtreeBounds();
+}
+
+bool Frame::isOnRecursively() const {
+    for (auto* frame = this; frame != nullptr; frame = frame->mOwner) {
+        if (!frame->mOn) return false;
+    }
+    return true;
 }
 
 std::shared_ptr<Frame> Frame::findFrame(const std::string& name) const {
@@ -128,11 +218,10 @@ void Frame::setMatrix(const glm::mat4& mat) {
 }
 
 bool Frame::isVisible() {
-    if(Renderer::isCamRelative()) return true;
-    if(auto* cam = App::get()->getScene()->getActiveCamera()) {
-        if(mSphereBounding != nullptr) {
-           return cam->getFrustum().checkSphere(mSphereBounding.get());
-        }
+    auto* scene = App::get()->getScene();
+    if(scene->isCullingBackdrop()) return true;
+    if(mSphereBounding != nullptr) {
+        return scene->isSphereVisible(mSphereBounding.get());
     }
 
     return false;
@@ -26,7 +26,8 @@ enum class FrameType
     Camera,
     Sector,
     Billboard,
-    Sound
+    Sound,
+    Occluder
 };
 
 constexpr const char* gFrameNames[] = {
@@ -40,9 +41,11 @@ constexpr const char* gFrameNames[] = {
     "Camera",
     "Sector",
     "Billboard",
-    "Sound"
+    "Sound",
+    "Occluder"
 };
 
+class Bvh;
 class Frame {
 public:
     Frame() :
@@ -79,7 +82,7 @@ public:
 
     const std::vector<std::shared_ptr<Frame>>& getChilds() { return mChilds; };
 
-    void removeChilds() { mChilds.clear(); }
+    void removeChilds() { mChilds.clear(); invalidateSubtreeBounds(); }
     
     const glm::mat4& getWorldMatrix();
     const glm::mat4& getMatrix() { return mTransform; }
@@ -87,6 +90,7 @@ public:
 
     const std::pair<glm::vec3, glm::vec3>& getWorldBBOX() const { return mABBBWorld; }
 
+    //NOTE: own box of frame geometry, models and meshes grow it by their children in local space
     void setBBOX(const std::pair<glm::vec3, glm::vec3>& bbox);
     const std::pair<glm::vec3, glm::vec3>& getBBOX() const { return mAABB; }
 
@@ -96,6 +100,9 @@ public:
     void setOn(bool on) { mOn = on; }
     bool isOn() const { return mOn; }
 
+    //NOTE: false if this or any owner is off
+    bool isOnRecursively() const;
+
     std::shared_ptr<Frame> findFrame(const std::string& name) const;
 
     void setPos(const glm::vec3& pos);
@@ -125,11 +132,34 @@ public:
     bool isVisible();
 
     Sphere* getSphere() { return mSphereBounding.get(); }
+
+    //NOTE: only for frames whose world AABB is much looser than their rotated box ( poles, walls )
+    const OrientedBox* getOrientedBox() const { return mOrientedBox.get(); }
+    static void setOrientedBoxesEnabled(bool enabled);
+    static bool isOrientedBoxesEnabled();
+
+    //NOTE: world bounds of frame with everything under it, recomputed lazily after something
+    //inside changed, invalidation walks up only until first already invalid ancestor
+    const std::pair<glm::vec3, glm::vec3>& getSubtreeBounds();
+    void invalidateSubtreeBounds();
+
+    //NOTE: subtree holds frames with per frame work ( sounds ), it is never culled
+    bool hasSubtreeUpdates() { getSubtreeBounds(); return mHasSubtreeUpdates; }
+
+    //NOTE: bvh this frame is leaf of, it gets refit when bounds change
+    void setBvh(Bvh* bvh, uint32_t index) { mBvh = bvh; mBvhIndex = index; }
 protected:
     void updateTransform();
     void updateBoundingVolumes();
-    std::pair<glm::vec3, glm::vec3> mAABB;
-    std::pair<glm::vec3, glm::vec3> mABBBWorld;
+
+    //NOTE: subtree bounds test against scene cull frusta, narrows plane mask for children,
+    //returns false when whole subtree can be skipped
+    bool beginSubtree(uint32_t& parentMask);
+    void endSubtree(uint32_t parentMask);
+    void renderChilds();
+    std::pair<glm::vec3, glm::vec3> mOwnAABB{ getEmptyAABB() };
+    std::pair<glm::vec3, glm::vec3> mAABB{ glm::vec3(0.0f), glm::vec3(0.0f) };
+    std::pair<glm::vec3, glm::vec3> mABBBWorld{ glm::vec3(0.0f), glm::vec3(0.0f) };
 
     bool mIsTransformDirty;
     bool mOn;
@@ -142,4 +172,10 @@ protected:
     Frame* mOwner;
     std::vector<std::shared_ptr<Frame>> mChilds;
     std::unique_ptr<Sphere> mSphereBounding;
+    std::unique_ptr<OrientedBox> mOrientedBox;
+    Bvh* mBvh{ nullptr };
+    uint32_t mBvhIndex{ 0 };
+    std::pair<glm::vec3, glm::vec3> mSubtreeBounds{ getEmptyAABB() };
+    bool mIsSubtreeDirty{ true };
+    bool mHasSubtreeUpdates{ false };
 };
\ No newline at end of file
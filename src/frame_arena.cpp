@@ -0,0 +1,69 @@
+#include "frame_arena.hpp"
+#include "stats.hpp"
+
+#include <algorithm>
+
+static FrameArena gArenas[2];
+static size_t gFrameIdx = 0;
+
+FrameArena& FrameArena::get() {
+    return gArenas[gFrameIdx & 1];
+}
+
+void FrameArena::nextFrame() {
+    gFrameIdx++;
+    
+    //NOTE: list that lived here was submitted this frame
+    auto& arena = get();
+    gStats.frameArenaBytes = arena.getUsed();
+    gStats.frameArenaCapacity = arena.getCapacity();
+    arena.reset();
+}
+
+void* FrameArena::allocate(size_t size, size_t alignment) {
+    for (;;) {
+        if (mBlock < mBlocks.size()) {
+            auto& block = mBlocks[mBlock];
+            const auto base = reinterpret_cast<uintptr_t>(block.data.get());
+            const auto aligned = (base + mOffset + alignment - 1) & ~(alignment - 1);
+            const auto end = aligned - base + size;
+            if (end <= block.size) {
+                mUsed += end - mOffset;
+                mOffset = end;
+                return reinterpret_cast<void*>(aligned);
+            }
+
+            mBlock++;
+            mOffset = 0;
+            continue;
+        }
+
+        //NOTE: out of space, grows only until frame fits into one block again
+        const auto lastSize = mBlocks.empty() ? InitialCapacity : mBlocks.back().size;
+        const auto blockSize = std::max(lastSize * 2, size + alignment);
+        mBlocks.push_back({ std::make_unique<uint8_t[]>(blockSize), blockSize });
+        mBlock = mBlocks.size() - 1;
+        mOffset = 0;
+    }
+}
+
+void FrameArena::reset() {
+    //NOTE: frame spilled over more blocks, merge them so it won't happen again
+    if (mBlocks.size() > 1) {
+        const auto capacity = getCapacity();
+        mBlocks.clear();
+        mBlocks.push_back({ std::make_unique<uint8_t[]>(capacity), capacity });
+    }
+
+    mBlock = 0;
+    mOffset = 0;
+    mUsed = 0;
+}
+
+size_t FrameArena::getCapacity() const {
+    size_t capacity = 0;
+    for (const auto& block : mBlocks) {
+        capacity += block.size;
+    }
+    return capacity;
+}
\ No newline at end of file
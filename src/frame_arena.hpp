@@ -0,0 +1,61 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <type_traits>
+
+//NOTE: bump allocator for render data that lives for a frame, nothing is freed one by one,
+//arena is rewound as whole in Renderer::commit. There are two of them: draw list culled
+//in frame N is submitted in frame N+1, so arena is rewound only after its list was drawn.
+//Only cull thread allocates from it.
+class FrameArena {
+public:
+    static constexpr size_t InitialCapacity = 4 * 1024 * 1024;
+
+    //NOTE: arena data culled this frame goes to
+    static FrameArena& get();
+
+    //NOTE: called from Renderer::commit when cull thread is idle
+    static void nextFrame();
+
+    void* allocate(size_t size, size_t alignment);
+    void reset();
+
+    [[nodiscard]] size_t getUsed() const { return mUsed; }
+    [[nodiscard]] size_t getCapacity() const;
+private:
+    struct Block {
+        std::unique_ptr<uint8_t[]> data;
+        size_t size;
+    };
+
+    std::vector<Block> mBlocks;
+    size_t mBlock = 0;
+    size_t mOffset = 0;
+    size_t mUsed = 0;
+};
+
+//NOTE: lets std containers take memory from current frame arena, deallocate is no-op.
+//Container has to be replaced by fresh one ( not = {}, that's clear() ) before its arena
+//is reused, clear() would keep capacity pointing into rewound memory
+template <typename T>
+struct FrameAllocator {
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    FrameAllocator() = default;
+    template <typename U> FrameAllocator(const FrameAllocator<U>&) {}
+
+    T* allocate(size_t count) { 
+        return static_cast<T*>(FrameArena::get().allocate(count * sizeof(T), alignof(T))); 
+    }
+
+    void deallocate(T*, size_t) {}
+
+    template <typename U> bool operator==(const FrameAllocator<U>&) const { return true; }
+    template <typename U> bool operator!=(const FrameAllocator<U>&) const { return false; }
+};
+
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
\ No newline at end of file
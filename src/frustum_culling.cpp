@@ -2,3 +2,215 @@
 // Created by david on 27. 5. 2021.
 //
 #include "frustum_culling.h"
+#include "simd.hpp"
+
+void BoundsSoA::resize(size_t newCount) {
+    count = newCount;
+    for (auto* values : { &centerX, &centerY, &centerZ, &extentX, &extentY, &extentZ, &radius }) {
+        values->assign(newCount + Padding, 0.0f);
+    }
+}
+
+void BoundsSoA::set(size_t index, const glm::vec3& min, const glm::vec3& max) {
+    const auto center = (min + max) * 0.5f;
+    const auto extent = (max - min) * 0.5f;
+    centerX[index] = center.x;
+    centerY[index] = center.y;
+    centerZ[index] = center.z;
+    extentX[index] = extent.x;
+    extentY[index] = extent.y;
+    extentZ[index] = extent.z;
+    radius[index] = glm::length(extent);
+}
+
+SimdLevel PortalFrustum::getSimdLevel() {
+#if defined(CULL_SSE)
+    static const SimdLevel level = [] {
+    #if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 1);
+        const bool osSavesYmm = (info[2] & (1 << 27)) && (_xgetbv(0) & 6) == 6;
+        const bool hasAvx = (info[2] & (1 << 28)) && osSavesYmm;
+    #else
+        const bool hasAvx = __builtin_cpu_supports("avx");
+    #endif
+        return hasAvx ? SimdLevel::AVX : SimdLevel::SSE;
+    }();
+    return level;
+#else
+    return SimdLevel::SCALAR;
+#endif
+}
+
+static void clearMask(uint32_t* mask, size_t count) {
+    std::fill(mask, mask + (count + 31) / 32, 0u);
+}
+
+//NOTE: bits of padding objects past count are dropped
+static void trimMask(uint32_t* mask, size_t count) {
+    if (count % 32) {
+        mask[count / 32] &= (1u << (count % 32)) - 1u;
+    }
+}
+
+//NOTE: box is outside when its center is farther behind plane than its extent projected on plane normal
+static void checkAabbsScalar(const glm::vec4* planes, int planeCount, const BoundsSoA& bounds, size_t first, size_t count, uint32_t* mask) {
+    for (size_t i = 0; i < count; i++) {
+        const auto object = first + i;
+        bool visible = true;
+        for (auto p = 0; p < planeCount && visible; p++) {
+            const auto& plane = planes[p];
+            const auto distance = plane.x * bounds.centerX[object] + plane.y * bounds.centerY[object] + plane.z * bounds.centerZ[object] + plane.w;
+            const auto extent = std::abs(plane.x) * bounds.extentX[object] + std::abs(plane.y) * bounds.extentY[object] + std::abs(plane.z) * bounds.extentZ[object];
+            visible = distance + extent >= 0.0f;
+        }
+
+        if (visible) {
+            mask[i / 32] |= 1u << (i % 32);
+        }
+    }
+}
+
+static void checkSpheresScalar(const glm::vec4* planes, int planeCount, const BoundsSoA& bounds, size_t first, size_t count, uint32_t* mask) {
+    for (size_t i = 0; i < count; i++) {
+        const auto object = first + i;
+        bool visible = true;
+        for (auto p = 0; p < planeCount && visible; p++) {
+            const auto& plane = planes[p];
+            const auto distance = plane.x * bounds.centerX[object] + plane.y * bounds.centerY[object] + plane.z * bounds.centerZ[object] + plane.w;
+            visible = distance > -bounds.radius[object];
+        }
+
+        if (visible) {
+            mask[i / 32] |= 1u << (i % 32);
+        }
+    }
+}
+
+#if defined(CULL_SSE)
+static void checkAabbsSse(const glm::vec4* planes, int planeCount, const BoundsSoA& bounds, size_t first, size_t count, uint32_t* mask) {
+    const auto signMask = _mm_set1_ps(-0.0f);
+    for (size_t i = 0; i < count; i += 4) {
+        const auto object = first + i;
+        const auto centerX = _mm_loadu_ps(&bounds.centerX[object]);
+        const auto centerY = _mm_loadu_ps(&bounds.centerY[object]);
+        const auto centerZ = _mm_loadu_ps(&bounds.centerZ[object]);
+        const auto extentX = _mm_loadu_ps(&bounds.extentX[object]);
+        const auto extentY = _mm_loadu_ps(&bounds.extentY[object]);
+        const auto extentZ = _mm_loadu_ps(&bounds.extentZ[object]);
+
+        auto visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (auto p = 0; p < planeCount; p++) {
+            const auto planeX = _mm_set1_ps(planes[p].x);
+            const auto planeY = _mm_set1_ps(planes[p].y);
+            const auto planeZ = _mm_set1_ps(planes[p].z);
+
+            auto distance = _mm_add_ps(_mm_mul_ps(planeX, centerX), _mm_set1_ps(planes[p].w));
+            distance = _mm_add_ps(distance, _mm_mul_ps(planeY, centerY));
+            distance = _mm_add_ps(distance, _mm_mul_ps(planeZ, centerZ));
+
+            auto extent = _mm_mul_ps(_mm_andnot_ps(signMask, planeX), extentX);
+            extent = _mm_add_ps(extent, _mm_mul_ps(_mm_andnot_ps(signMask, planeY), extentY));
+            extent = _mm_add_ps(extent, _mm_mul_ps(_mm_andnot_ps(signMask, planeZ), extentZ));
+
+            visible = _mm_and_ps(visible, _mm_cmpge_ps(_mm_add_ps(distance, extent), _mm_setzero_ps()));
+            if (_mm_movemask_ps(visible) == 0) break;
+        }
+
+        mask[i / 32] |= static_cast<uint32_t>(_mm_movemask_ps(visible)) << (i % 32);
+    }
+}
+
+static void checkSpheresSse(const glm::vec4* planes, int planeCount, const BoundsSoA& bounds, size_t first, size_t count, uint32_t* mask) {
+    for (size_t i = 0; i < count; i += 4) {
+        const auto object = first + i;
+        const auto centerX = _mm_loadu_ps(&bounds.centerX[object]);
+        const auto centerY = _mm_loadu_ps(&bounds.centerY[object]);
+        const auto centerZ = _mm_loadu_ps(&bounds.centerZ[object]);
+        const auto radius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(&bounds.radius[object]));
+
+        auto visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (auto p = 0; p < planeCount; p++) {
+            auto distance = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes[p].x), centerX), _mm_set1_ps(planes[p].w));
+            distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(planes[p].y), centerY));
+            distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(planes[p].z), centerZ));
+
+            visible = _mm_and_ps(visible, _mm_cmpgt_ps(distance, radius));
+            if (_mm_movemask_ps(visible) == 0) break;
+        }
+
+        mask[i / 32] |= static_cast<uint32_t>(_mm_movemask_ps(visible)) << (i % 32);
+    }
+}
+
+CULL_AVX_TARGET static void checkAabbsAvx(const glm::vec4* planes, int planeCount, const BoundsSoA& bounds, size_t first, size_t count, uint32_t* mask) {
+    const auto signMask = _mm256_set1_ps(-0.0f);
+    for (size_t i = 0; i < count; i += 8) {
+        const auto object = first + i;
+        const auto centerX = _mm256_loadu_ps(&bounds.centerX[object]);
+        const auto centerY = _mm256_loadu_ps(&bounds.centerY[object]);
+        const auto centerZ = _mm256_loadu_ps(&bounds.centerZ[object]);
+        const auto extentX = _mm256_loadu_ps(&bounds.extentX[object]);
+        const auto extentY = _mm256_loadu_ps(&bounds.extentY[object]);
+        const auto extentZ = _mm256_loadu_ps(&bounds.extentZ[object]);
+
+        auto visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (auto p = 0; p < planeCount; p++) {
+            const auto planeX = _mm256_set1_ps(planes[p].x);
+            const auto planeY = _mm256_set1_ps(planes[p].y);
+            const auto planeZ = _mm256_set1_ps(planes[p].z);
+
+            auto distance = _mm256_add_ps(_mm256_mul_ps(planeX, centerX), _mm256_set1_ps(planes[p].w));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(planeY, centerY));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(planeZ, centerZ));
+
+            auto extent = _mm256_mul_ps(_mm256_andnot_ps(signMask, planeX), extentX);
+            extent = _mm256_add_ps(extent, _mm256_mul_ps(_mm256_andnot_ps(signMask, planeY), extentY));
+            extent = _mm256_add_ps(extent, _mm256_mul_ps(_mm256_andnot_ps(signMask, planeZ), extentZ));
+
+            visible = _mm256_and_ps(visible, _mm256_cmp_ps(_mm256_add_ps(distance, extent), _mm256_setzero_ps(), _CMP_GE_OQ));
+            if (_mm256_movemask_ps(visible) == 0) break;
+        }
+
+        mask[i / 32] |= static_cast<uint32_t>(_mm256_movemask_ps(visible)) << (i % 32);
+    }
+}
+#endif
+
+void PortalFrustum::checkAabbs(const BoundsSoA& bounds, size_t first, size_t count, uint32_t* mask, SimdLevel level) const {
+    clearMask(mask, count);
+
+    //NOTE: wide loads need objects up to padding past count
+    if (first + count > bounds.count) return;
+
+#if defined(CULL_SSE)
+    if (level == SimdLevel::AVX && count > 4) {
+        checkAabbsAvx(planes.data(), planeCount, bounds, first, count, mask);
+        trimMask(mask, count);
+        return;
+    }
+
+    if (level != SimdLevel::SCALAR) {
+        checkAabbsSse(planes.data(), planeCount, bounds, first, count, mask);
+        trimMask(mask, count);
+        return;
+    }
+#endif
+
+    checkAabbsScalar(planes.data(), planeCount, bounds, first, count, mask);
+}
+
+void PortalFrustum::checkSpheres(const BoundsSoA& bounds, size_t first, size_t count, uint32_t* mask, SimdLevel level) const {
+    clearMask(mask, count);
+    if (first + count > bounds.count) return;
+
+#if defined(CULL_SSE)
+    if (level != SimdLevel::SCALAR) {
+        checkSpheresSse(planes.data(), planeCount, bounds, first, count, mask);
+        trimMask(mask, count);
+        return;
+    }
+#endif
+
+    checkSpheresScalar(planes.data(), planeCount, bounds, first, count, mask);
+}
\ No newline at end of file
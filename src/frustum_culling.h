@@ -1,5 +1,11 @@
+#pragma once
 #include <glm/matrix.hpp>
 #include <array>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <bit>
  
 #include "bounding_volumes.hpp"
 
@@ -51,6 +57,168 @@ public:
                 return false;
             }
         }
+        return true;
+    }
+};
+
+//NOTE: culling data laid out per component so 4 or 8 objects are tested at once,
+//boxes are center and half extent, arrays are padded so wide loads past last object stay inside
+struct BoundsSoA {
+    static constexpr size_t Padding = 8;
+
+    std::vector<float> centerX, centerY, centerZ;
+    std::vector<float> extentX, extentY, extentZ;
+    std::vector<float> radius;
+    size_t count = 0;
+
+    void resize(size_t newCount);
+    void set(size_t index, const glm::vec3& min, const glm::vec3& max);
+    [[nodiscard]] glm::vec3 getMin(size_t index) const { return glm::vec3(centerX[index] - extentX[index], centerY[index] - extentY[index], centerZ[index] - extentZ[index]); }
+    [[nodiscard]] glm::vec3 getMax(size_t index) const { return glm::vec3(centerX[index] + extentX[index], centerY[index] + extentY[index], centerZ[index] + extentZ[index]); }
+};
+
+enum class SimdLevel {
+    SCALAR,
+    SSE,
+    AVX
+};
+
+//NOTE: view frustum narrowed by portals, near and far plane are kept as first two,
+//rest are planes through eye and portal edges, all pointing inwards like Frustum ones
+class PortalFrustum {
+public:
+    static constexpr int MaxPlanes = 16;
+    static constexpr int MaxPortalVertices = 32;
+    std::array<glm::vec4, MaxPlanes> planes;
+    int planeCount = 0;
+
+    void set(const Frustum& frustum) {
+        planes[0] = frustum.planes[Frustum::BACK];
+        planes[1] = frustum.planes[Frustum::FRONT];
+        planes[2] = frustum.planes[Frustum::LEFT];
+        planes[3] = frustum.planes[Frustum::RIGHT];
+        planes[4] = frustum.planes[Frustum::TOP];
+        planes[5] = frustum.planes[Frustum::BOTTOM];
+        planeCount = 6;
+    }
+
+    bool checkSphere(const Sphere* sphere) const {
+        for (auto i = 0; i < planeCount; i++) {
+            if (glm::dot(glm::vec3(planes[i]), sphere->center) + planes[i].w <= -sphere->radius) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //NOTE: hierarchical test, only planes with bit in mask are checked and planes box is fully
+    //inside of are cleared, children of box then skip them. False when box is outside
+    bool checkAabbMasked(const glm::vec3& min, const glm::vec3& max, uint32_t& mask) const {
+        mask &= (1u << planeCount) - 1;
+        for (auto bits = mask; bits != 0; bits &= bits - 1) {
+            const auto i = std::countr_zero(bits);
+            const glm::vec3 normal(planes[i]);
+            const auto positive = glm::mix(min, max, glm::greaterThanEqual(normal, glm::vec3(0.0f)));
+            const auto negative = glm::mix(max, min, glm::greaterThanEqual(normal, glm::vec3(0.0f)));
+
+            if (glm::dot(normal, positive) + planes[i].w < 0.0f) {
+                return false;
+            }
+
+            if (glm::dot(normal, negative) + planes[i].w >= 0.0f) {
+                mask &= ~(1u << i);
+            }
+        }
+        return true;
+    }
+
+    bool checkOrientedBox(const OrientedBox* box) const {
+        for (auto i = 0; i < planeCount; i++) {
+            const glm::vec3 normal(planes[i]);
+            const auto distance = glm::dot(normal, box->center) + planes[i].w;
+            const auto extent = std::abs(glm::dot(normal, box->axes[0])) + std::abs(glm::dot(normal, box->axes[1])) + std::abs(glm::dot(normal, box->axes[2]));
+            if (distance + extent < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //NOTE: visibility bitmask of objects first .. first + count, bit i is object first + i,
+    //mask has to hold ( count + 31 ) / 32 words
+    void checkAabbs(const BoundsSoA& bounds, size_t first, size_t count, uint32_t* mask, SimdLevel level = getSimdLevel()) const;
+    void checkSpheres(const BoundsSoA& bounds, size_t first, size_t count, uint32_t* mask, SimdLevel level = getSimdLevel()) const;
+
+    //NOTE: best level cpu supports, checked once
+    static SimdLevel getSimdLevel();
+
+    //NOTE: clips portal polygon by this volume, when something is left narrowed 
+    //gets volume seen through it, returns false when portal is not visible
+    bool narrow(const glm::vec3& eye, const glm::vec3* vertices, int count, PortalFrustum& narrowed) const {
+        std::array<glm::vec3, MaxPortalVertices> polygons[2];
+        int polygonCount = std::min(count, MaxPortalVertices / 2);
+        std::copy(vertices, vertices + polygonCount, polygons[0].begin());
+
+        //NOTE: Sutherland-Hodgman, every plane adds at most one vertex
+        int current = 0;
+        for (auto i = 0; i < planeCount && polygonCount >= 3; i++) {
+            const auto& plane = planes[i];
+            const auto& in = polygons[current];
+            auto& out = polygons[current ^ 1];
+            int outCount = 0;
+
+            for (auto v = 0; v < polygonCount && outCount < MaxPortalVertices - 1; v++) {
+                const auto& a = in[v];
+                const auto& b = in[(v + 1) % polygonCount];
+                const auto da = glm::dot(glm::vec3(plane), a) + plane.w;
+                const auto db = glm::dot(glm::vec3(plane), b) + plane.w;
+                if (da >= 0.0f) {
+                    out[outCount++] = a;
+                }
+                if ((da >= 0.0f) != (db >= 0.0f)) {
+                    out[outCount++] = a + (b - a) * (da / (da - db));
+                }
+            }
+
+            polygonCount = outCount;
+            current ^= 1;
+        }
+
+        if (polygonCount < 3) {
+            return false;
+        }
+
+        const auto& polygon = polygons[current];
+        glm::vec3 centroid(0.0f);
+        for (auto v = 0; v < polygonCount; v++) {
+            centroid += polygon[v];
+        }
+        centroid /= static_cast<float>(polygonCount);
+
+        //NOTE: eye standing in portal, edge planes would be degenerate so keep what we have
+        const auto normal = glm::cross(polygon[1] - polygon[0], polygon[2] - polygon[0]);
+        const auto normalLength = glm::length(normal);
+        if (normalLength < 1e-6f || std::abs(glm::dot(normal / normalLength, eye - polygon[0])) < 0.1f) {
+            narrowed = *this;
+            return true;
+        }
+
+        narrowed.planes[0] = planes[0];
+        narrowed.planes[1] = planes[1];
+        narrowed.planeCount = 2;
+        for (auto v = 0; v < polygonCount && narrowed.planeCount < MaxPlanes; v++) {
+            const auto edgeNormal = glm::cross(polygon[v] - eye, polygon[(v + 1) % polygonCount] - eye);
+            const auto length = glm::length(edgeNormal);
+            if (length < 1e-6f) continue;
+
+            glm::vec4 plane(edgeNormal / length, 0.0f);
+            plane.w = -glm::dot(glm::vec3(plane), eye);
+            if (glm::dot(glm::vec3(plane), centroid) + plane.w < 0.0f) {
+                plane = -plane;
+            }
+            narrowed.planes[narrowed.planeCount++] = plane;
+        }
+
         return true;
     }
 };
\ No newline at end of file
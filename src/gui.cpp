@@ -9,6 +9,7 @@
 #include "vfs.hpp"
 #include "logger.hpp"
 #include "single_mesh.hpp"
+#include "texture.hpp"
 
 #include "imgui_ansi.hpp"
 #include "IconsFontAwesome5.h"
@@ -549,6 +550,127 @@ void Gui::render() {
     ImGui::Text("Models in use: %d", gStats.modelsInUse);
     ImGui::Text("Billboards in use: %d", gStats.billboardsInUse);
     ImGui::Text("Textures in use: %d", gStats.texturesInUse);
+    ImGui::Text("Draw calls: %u (%u without instancing, %u instanced)", gStats.drawCalls, gStats.drawCallsUninstanced, gStats.instancedDraws);
+    ImGui::Text("Transparent draws: %u / %u budget%s", gStats.transparentDraws, RenderQueue::getTransparentDrawBudget(), gStats.transparentDraws > RenderQueue::getTransparentDrawBudget() ? " (over budget)" : "");
+    ImGui::Text("Transparent CPU: sort + build %.3f ms, submit %.3f ms", gStats.transparentBuildMs, gStats.transparentSubmitMs);
+    ImGui::Text("Static batches: %u baked from %u meshes, %u face groups drawn in %u calls", gStats.staticBatches, gStats.staticBatchedMeshes, gStats.staticBatchMembers, gStats.staticBatchDraws);
+    ImGui::Text("Pipeline switches: %u (unsorted %u, skipped %u)", gStats.pipelineSwitches, gStats.pipelineSwitchesUnsorted, gStats.pipelineSwitchesSkipped);
+    ImGui::Text("Binding switches: %u (unsorted %u, skipped %u)", gStats.bindingSwitches, gStats.bindingSwitchesUnsorted, gStats.bindingSwitchesSkipped);
+    ImGui::Text("Uniform uploads: %u (skipped %u)", gStats.uniformUploads, gStats.uniformUploadsSkipped);
+    ImGui::Text("Texture memory: %.2f / %.2f MB resident (dedup saved %.2f MB)", gStats.textureBytesInUse / (1024.0f * 1024.0f), Texture::getResidencyBudget() / (1024.0f * 1024.0f), gStats.textureBytesDeduped / (1024.0f * 1024.0f));
+    ImGui::Text("Textures streaming: %zu, mip requests pending: %zu", Texture::getPendingCount(), Texture::getPendingResidencyCount());
+    ImGui::Text("Sectors visited: %u / %u (portals %u tested, %u passed)", gStats.sectorsVisited, gStats.sectorsTotal, gStats.portalsTested, gStats.portalsPassed);
+    ImGui::Text("BVH: %u nodes, %u tested, %u leaves refit", gStats.bvhNodes, gStats.bvhNodesTested, gStats.bvhLeavesRefit);
+    ImGui::Text("LOD: %u triangles submitted (%u without LOD), %u meshes on coarser LOD", gStats.lodTriangles, gStats.lodTrianglesFull, gStats.lodCoarserMeshes);
+    ImGui::Text("Impostors: %u / %u models captured, %u instances, atlas %ux%u, %u drawn replacing %u meshes", gStats.impostorModelsCaptured, gStats.impostorModels, gStats.impostorInstances, gStats.impostorAtlasSize, gStats.impostorAtlasSize, gStats.impostorsDrawn, gStats.impostorMeshesReplaced);
+    ImGui::Text("Hierarchy: %u subtrees tested, %u culled, %u plane tests (%u skipped by mask)", gStats.subtreesTested, gStats.subtreesCulled, gStats.subtreePlaneTests, gStats.subtreePlaneTestsSkipped);
+    ImGui::Text("Camera sector lookup: %u hull tests (%s)", gStats.sectorLookupTests, gStats.isSectorLookupCoherent ? "coherent" : "index");
+    ImGui::Text("PVS: %s in %.1f ms, %u sectors potentially visible", gStats.pvsFromCache ? "loaded" : "baked", gStats.pvsMs, gStats.pvsSectors);
+    ImGui::Text("Occlusion: %u occluders (%u tris), %u / %u occluded, %.3f ms (raster %.3f ms)", gStats.occluders, gStats.occluderTriangles, gStats.occluded, gStats.occlusionTested, gStats.occlusionMs, gStats.occlusionRasterMs);
+    ImGui::Text("Cull: %.3f ms, submit: %.3f ms, overlapped: %.3f ms", gStats.cullMs, gStats.submitMs, gStats.overlapMs);
+    ImGui::Text("Heap allocations: %u per frame", gStats.heapAllocations);
+    ImGui::Text("Frame arena: %.2f / %.2f MB", gStats.frameArenaBytes / (1024.0f * 1024.0f), gStats.frameArenaCapacity / (1024.0f * 1024.0f));
+
+    //NOTE: frame time history, shows what cull thread buys back
+    static float frameTimes[120] = {};
+    static int frameTimeIdx = 0;
+    frameTimes[frameTimeIdx] = 1000.0f / ImGui::GetIO().Framerate;
+    frameTimeIdx = (frameTimeIdx + 1) % IM_ARRAYSIZE(frameTimes);
+    ImGui::PlotLines("Frame ms", frameTimes, IM_ARRAYSIZE(frameTimes), frameTimeIdx, nullptr, 0.0f, 33.3f, ImVec2(0.0f, 40.0f));
+
+    bool palettedEnabled = Texture::isPalettedEnabled();
+    if (ImGui::Checkbox("Paletted textures (applies on next load)", &palettedEnabled)) {
+        Texture::setPalettedEnabled(palettedEnabled);
+    }
+
+    bool instancingEnabled = RenderQueue::isInstancingEnabled();
+    if (ImGui::Checkbox("Instancing", &instancingEnabled)) {
+        RenderQueue::setInstancingEnabled(instancingEnabled);
+    }
+
+    bool staticBatchingEnabled = RenderQueue::isStaticBatchingEnabled();
+    if (ImGui::Checkbox("Static batching", &staticBatchingEnabled)) {
+        RenderQueue::setStaticBatchingEnabled(staticBatchingEnabled);
+    }
+
+    //NOTE: switch and compare transparent CPU cost above
+    int transparencyMode = static_cast<int>(Renderer::getTransparencyMode());
+    if (ImGui::Combo("Transparency", &transparencyMode, "Sorted\0Weighted blended OIT\0")) {
+        Renderer::setTransparencyMode(static_cast<Renderer::TransparencyMode>(transparencyMode));
+    }
+
+    int transparentDrawBudget = static_cast<int>(RenderQueue::getTransparentDrawBudget());
+    if (ImGui::SliderInt("Transparent draw budget", &transparentDrawBudget, 0, 4096)) {
+        RenderQueue::setTransparentDrawBudget(static_cast<unsigned int>(transparentDrawBudget));
+    }
+
+    bool threadedCullingEnabled = Scene::isThreadedCullingEnabled();
+    if (ImGui::Checkbox("Threaded culling", &threadedCullingEnabled)) {
+        Scene::setThreadedCullingEnabled(threadedCullingEnabled);
+    }
+
+    bool portalCullingEnabled = Scene::isPortalCullingEnabled();
+    if (ImGui::Checkbox("Portal culling", &portalCullingEnabled)) {
+        Scene::setPortalCullingEnabled(portalCullingEnabled);
+    }
+
+    bool bvhCullingEnabled = Scene::isBvhCullingEnabled();
+    if (ImGui::Checkbox("BVH culling", &bvhCullingEnabled)) {
+        Scene::setBvhCullingEnabled(bvhCullingEnabled);
+    }
+
+    bool pvsEnabled = Scene::isPvsEnabled();
+    if (ImGui::Checkbox("PVS", &pvsEnabled)) {
+        Scene::setPvsEnabled(pvsEnabled);
+    }
+
+    static Scene::PvsValidation pvsValidation;
+    if (ImGui::Button("Validate PVS")) {
+        pvsValidation = scene->validatePvs(1000);
+    }
+
+    if (pvsValidation.samples > 0) {
+        ImGui::Text("%zu samples in %.1f ms, %zu fell into sectors without PVS", pvsValidation.samples, pvsValidation.ms, pvsValidation.unsampled);
+        ImGui::Text("  missed sectors %zu / %zu, missed meshes %zu / %zu, PVS %.1f meshes per view (%.1f visible)", 
+            pvsValidation.missedSectors, pvsValidation.visibleSectors, pvsValidation.missedMeshes, pvsValidation.visibleMeshes, 
+            static_cast<float>(pvsValidation.pvsMeshes) / pvsValidation.samples, static_cast<float>(pvsValidation.visibleMeshes) / pvsValidation.samples);
+    }
+
+    bool lodEnabled = Scene::isLodEnabled();
+    if (ImGui::Checkbox("LOD", &lodEnabled)) {
+        Scene::setLodEnabled(lodEnabled);
+    }
+
+    float lodBias = Scene::getLodBias();
+    if (ImGui::SliderFloat("LOD bias", &lodBias, 0.25f, 4.0f)) {
+        Scene::setLodBias(lodBias);
+    }
+
+    bool impostorsEnabled = ImpostorAtlas::isEnabled();
+    if (ImGui::Checkbox("Impostors", &impostorsEnabled)) {
+        ImpostorAtlas::setEnabled(impostorsEnabled);
+    }
+
+    float impostorDistance = ImpostorAtlas::getDistance();
+    if (ImGui::SliderFloat("Impostor distance", &impostorDistance, 25.0f, 1000.0f)) {
+        ImpostorAtlas::setDistance(impostorDistance);
+    }
+
+    int impostorBudgetMb = static_cast<int>(ImpostorAtlas::getBudget() / (1024 * 1024));
+    if (ImGui::SliderInt("Impostor atlas MB (applies on next load)", &impostorBudgetMb, 0, 64)) {
+        ImpostorAtlas::setBudget(static_cast<size_t>(impostorBudgetMb) * 1024 * 1024);
+    }
+
+    bool occlusionCullingEnabled = Scene::isOcclusionCullingEnabled();
+    if (ImGui::Checkbox("Occlusion culling", &occlusionCullingEnabled)) {
+        Scene::setOcclusionCullingEnabled(occlusionCullingEnabled);
+    }
+
+    bool orientedBoxesEnabled = Frame::isOrientedBoxesEnabled();
+    if (ImGui::Checkbox("Oriented boxes", &orientedBoxesEnabled)) {
+        Frame::setOrientedBoxesEnabled(orientedBoxesEnabled);
+    }
+
     ImGui::Separator();
     ImGui::Text("%.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
     ImGui::End();
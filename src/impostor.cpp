@@ -0,0 +1,354 @@
+#include "impostor.hpp"
+#include "model.hpp"
+#include "sector.hpp"
+#include "light.hpp"
+#include "material.hpp"
+#include "logger.hpp"
+#include "stats.hpp"
+
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+
+/*
+    Impostor
+*/
+
+Impostor::Impostor(const ImpostorModel* model) : mModel(model) {
+    //NOTE: light is baked into atlas, quad only passes it through
+    Renderer::Light light{};
+    light.type = Renderer::LightType::Ambient;
+    light.ambient = glm::vec3(1.0f);
+    mLights.push_back(light);
+
+    //NOTE: render queue snapshots MaxLights per draw, rest stays zeroed like in Mesh::updateLights
+    mLights.resize(Renderer::MaxLights);
+    mUpdateLights = false;
+}
+
+bool Impostor::isActive(const glm::vec3& viewPos, float distanceScale) {
+    if (!mModel->isCaptured) return false;
+
+    //NOTE: impostor isn't child of model, so it never hears model moved
+    invalidateTransform();
+    const auto distance = glm::length(glm::vec3(getWorldMatrix()[3]) - viewPos) * distanceScale;
+    const auto hysteresis = mIsActive ? 1.0f - LodHysteresis : 1.0f + LodHysteresis;
+    mIsActive = distance > ImpostorAtlas::getDistance() * hysteresis;
+    return mIsActive;
+}
+
+FaceGroup* Impostor::selectFaceGroup(const glm::vec3& viewPos) {
+    const auto& world = getWorldMatrix();
+    const auto toView = viewPos - glm::vec3(world[3]);
+    const auto angle = glm::atan(glm::dot(toView, glm::normalize(glm::vec3(world[0]))), glm::dot(toView, glm::normalize(glm::vec3(world[2]))));
+    const auto step = glm::two_pi<float>() / static_cast<float>(ImpostorAtlas::AngleCount);
+
+    auto index = static_cast<int>(glm::round(angle / step)) % ImpostorAtlas::AngleCount;
+    if (index < 0) {
+        index += ImpostorAtlas::AngleCount;
+    }
+
+    return mModel->faceGroups[index].get();
+}
+
+bool Impostor::markQueued(uint64_t cullFrame) {
+    if (mQueuedFrame == cullFrame) return false;
+    mQueuedFrame = cullFrame;
+    return true;
+}
+
+/*
+    ImpostorAtlas
+*/
+
+static bool gImpostorsEnabled = true;
+static float gImpostorDistance = 150.0f;
+static size_t gImpostorBudget = 16 * 1024 * 1024;
+
+void ImpostorAtlas::setEnabled(bool enabled) {
+    gImpostorsEnabled = enabled;
+}
+
+bool ImpostorAtlas::isEnabled() {
+    return gImpostorsEnabled;
+}
+
+void ImpostorAtlas::setDistance(float distance) {
+    gImpostorDistance = distance;
+}
+
+float ImpostorAtlas::getDistance() {
+    return gImpostorDistance;
+}
+
+void ImpostorAtlas::setBudget(size_t bytes) {
+    gImpostorBudget = bytes;
+}
+
+size_t ImpostorAtlas::getBudget() {
+    return gImpostorBudget;
+}
+
+void ImpostorAtlas::build(const std::unordered_map<std::string, std::vector<Model*>>& instances) {
+    clear();
+
+    //NOTE: biggest square atlas of whole cells fitting budget
+    auto size = MaxAtlasSize;
+    while (size > CellSize && static_cast<size_t>(size) * size * 4 > gImpostorBudget) {
+        size /= 2;
+    }
+
+    const auto cellsPerRow = size / CellSize;
+    const auto maxModels = static_cast<size_t>(cellsPerRow * cellsPerRow / AngleCount);
+    if (static_cast<size_t>(size) * size * 4 > gImpostorBudget || maxModels == 0) {
+        Logger::get().warn("impostor atlas budget {} bytes can't hold single model", gImpostorBudget);
+        return;
+    }
+
+    //NOTE: models placed most times save most, name keeps order same between loads
+    using Entry = std::pair<const std::string, std::vector<Model*>>;
+    std::vector<const Entry*> order;
+    for (const auto& entry : instances) {
+        if (!entry.second.empty()) {
+            order.push_back(&entry);
+        }
+    }
+
+    std::sort(order.begin(), order.end(), [](const Entry* a, const Entry* b) {
+        if (a->second.size() != b->second.size()) return a->second.size() > b->second.size();
+        return a->first < b->first;
+    });
+
+    mMaterial = std::make_shared<Material>();
+    mMaterial->setKind(Renderer::MaterialKind::BILLBOARD);
+    mMaterial->setDoubleSided(true);
+
+    for (const auto* entry : order) {
+        if (mModels.size() >= maxModels) break;
+
+        auto* source = entry->second.front();
+        const auto& box = source->getBBOX();
+        const auto extent = box.second - box.first;
+        const auto radius = glm::length(glm::vec2(extent.x, extent.z)) * 0.5f;
+        if (radius < MinExtent || extent.y < MinExtent) continue;
+
+        auto model = std::make_unique<ImpostorModel>();
+        model->source = source;
+        model->center = (box.first + box.second) * 0.5f;
+        model->radius = radius;
+        model->minY = box.first.y;
+        model->maxY = box.second.y;
+        model->firstCell = static_cast<int>(mModels.size()) * AngleCount;
+
+        //NOTE: quad spans model width seen from any side, uvs cover cell without padding
+        for (int angle = 0; angle < AngleCount; angle++) {
+            const auto cell = model->firstCell + angle;
+            const auto x0 = static_cast<float>((cell % cellsPerRow) * CellSize + CellPadding) / static_cast<float>(size);
+            const auto y0 = static_cast<float>((cell / cellsPerRow) * CellSize + CellPadding) / static_cast<float>(size);
+            const auto x1 = x0 + static_cast<float>(CellSize - CellPadding * 2) / static_cast<float>(size);
+            const auto y1 = y0 + static_cast<float>(CellSize - CellPadding * 2) / static_cast<float>(size);
+
+            const auto base = static_cast<uint16_t>(model->vertices.size());
+            const glm::vec3 normal(0.0f, 0.0f, 1.0f);
+            model->vertices.push_back({ { -radius, model->minY, 0.0f }, normal, { x0, y0 }, glm::vec2(0.0f), glm::vec2(0.0f) });
+            model->vertices.push_back({ {  radius, model->minY, 0.0f }, normal, { x1, y0 }, glm::vec2(0.0f), glm::vec2(0.0f) });
+            model->vertices.push_back({ {  radius, model->maxY, 0.0f }, normal, { x1, y1 }, glm::vec2(0.0f), glm::vec2(0.0f) });
+            model->vertices.push_back({ { -radius, model->maxY, 0.0f }, normal, { x0, y1 }, glm::vec2(0.0f), glm::vec2(0.0f) });
+
+            std::vector<uint16_t> indices = { base, static_cast<uint16_t>(base + 1), static_cast<uint16_t>(base + 2),
+                                              base, static_cast<uint16_t>(base + 2), static_cast<uint16_t>(base + 3) };
+            auto faceGroup = std::make_unique<FaceGroup>(std::move(indices), std::weak_ptr<Mesh>());
+            faceGroup->setMaterial(mMaterial);
+            model->faceGroups.push_back(std::move(faceGroup));
+        }
+
+        for (auto* instance : entry->second) {
+            auto impostor = std::make_shared<Impostor>(model.get());
+            impostor->setOwner(instance);
+            impostor->setPos({ model->center.x, 0.0f, model->center.z });
+            instance->forEach<Mesh>([&](Mesh* mesh) { mesh->setImpostor(impostor.get()); }, instance);
+            mImpostors.push_back(std::move(impostor));
+        }
+
+        mModels.push_back(std::move(model));
+    }
+
+    if (mModels.empty()) return;
+
+    mSize = size;
+    mPending = mModels.size();
+    mTexture = Renderer::createCaptureTexture(size, size);
+    mMaterial->setDiffuseHandle(mTexture);
+
+    gStats.impostorModels = static_cast<unsigned int>(mModels.size());
+    gStats.impostorInstances = static_cast<unsigned int>(mImpostors.size());
+    gStats.impostorAtlasSize = static_cast<unsigned int>(size);
+    Logger::get().info("impostors for {} of {} models ( {} instances ) in {}x{} atlas", mModels.size(), instances.size(), mImpostors.size(), size, size);
+}
+
+void ImpostorAtlas::appendGeometry(std::vector<Renderer::Vertex>& vertices, std::vector<uint32_t>& indices) {
+    for (const auto& model : mModels) {
+        const auto currentVerticesCount = static_cast<uint32_t>(vertices.size());
+        vertices.insert(vertices.end(), model->vertices.begin(), model->vertices.end());
+
+        for (const auto& faceGroup : model->faceGroups) {
+            faceGroup->setOffset(indices.size());
+            for (auto i : faceGroup->getIndices()) {
+                indices.push_back(i + currentVerticesCount);
+            }
+        }
+    }
+}
+
+bool ImpostorAtlas::isStreamedIn(ImpostorModel& model) {
+    bool streamedIn = true;
+    model.source->forEach<Mesh>([&](Mesh* mesh) {
+        for (const auto& faceGroup : mesh->getFaceGroups()) {
+            const auto& material = faceGroup->getMaterial();
+            if (material == nullptr) continue;
+
+            //NOTE: keep textures requested, nothing else asks for them while model is far
+            material->requestTextureSize(static_cast<float>(CellSize));
+            streamedIn = streamedIn && material->isStreamedIn();
+        }
+    }, model.source);
+    return streamedIn;
+}
+
+void ImpostorAtlas::update(Sector* sector, Renderer::BufferHandle vertexBuffer, Renderer::BufferHandle indexBuffer) {
+    if (mPending == 0 || sector == nullptr) return;
+
+    //NOTE: point lights are local, far away model is lit by sun and ambient only
+    std::vector<Renderer::Light> sectorLights;
+    for (const auto& light : sector->getLights()) {
+        if (light->getType() == LightType::Dir) {
+            Renderer::Light rLight {};
+            rLight.type     = Renderer::LightType::Dir;
+            rLight.dir      = light->getDir();
+            rLight.ambient  = light->getAmbient();
+            rLight.diffuse  = light->getDiffuse();
+            sectorLights.push_back(rLight);
+        } else if (light->getType() == LightType::Ambient) {
+            Renderer::Light rLight {};
+            rLight.type     = Renderer::LightType::Ambient;
+            rLight.ambient  = light->getAmbient();
+            sectorLights.push_back(rLight);
+        }
+
+        if (sectorLights.size() == Renderer::MaxLights) break;
+    }
+
+    int captures = 0;
+    for (auto& model : mModels) {
+        if (captures == MaxCapturesPerFrame) break;
+        if (model->isCaptured) continue;
+
+        //NOTE: texture which never streams in doesn't hold model back forever
+        if (!isStreamedIn(*model) && ++model->waitFrames < MaxCaptureWaitFrames) continue;
+
+        if (captures == 0) {
+            Renderer::beginCapture(mTexture, !mIsCleared);
+            mIsCleared = true;
+        }
+
+        capture(*model, sectorLights, vertexBuffer, indexBuffer);
+        model->isCaptured = true;
+        mPending--;
+        captures++;
+    }
+
+    if (captures > 0) {
+        Renderer::endCapture();
+        gStats.impostorModelsCaptured = static_cast<unsigned int>(getCapturedCount());
+    }
+}
+
+void ImpostorAtlas::capture(ImpostorModel& model, const std::vector<Renderer::Light>& sectorLights,
+    Renderer::BufferHandle vertexBuffer, Renderer::BufferHandle indexBuffer) {
+    //NOTE: model is drawn in its own space, sun is turned into it
+    const auto worldToLocal = glm::inverse(model.source->getWorldMatrix());
+    std::vector<Renderer::Light> lights = sectorLights;
+    for (auto& light : lights) {
+        if (light.type == Renderer::LightType::Dir) {
+            light.dir = glm::normalize(glm::mat3(worldToLocal) * light.dir);
+        }
+    }
+
+    //NOTE: orthographic view matches flat quad, captured without fog which is applied on quad
+    const glm::vec3 target(model.center.x, (model.minY + model.maxY) * 0.5f, model.center.z);
+    const auto halfHeight = (model.maxY - model.minY) * 0.5f;
+    const auto distance = model.radius + 1.0f;
+    Renderer::setCamRelative(false);
+    Renderer::setProjMatrix(glm::ortho(-model.radius, model.radius, -halfHeight, halfHeight, 0.0f, distance + model.radius + 1.0f));
+    Renderer::setFog(glm::vec3(0.0f), glm::vec2(0.0f));
+
+    Renderer::Material untextured{};
+    untextured.kind = Renderer::MaterialKind::DIFFUSE;
+
+    const auto cellsPerRow = mSize / CellSize;
+    for (int angle = 0; angle < AngleCount; angle++) {
+        const auto cell = model.firstCell + angle;
+        Renderer::setViewport((cell % cellsPerRow) * CellSize + CellPadding, (cell / cellsPerRow) * CellSize + CellPadding,
+            CellSize - CellPadding * 2, CellSize - CellPadding * 2);
+
+        const auto theta = glm::two_pi<float>() * static_cast<float>(angle) / static_cast<float>(AngleCount);
+        const auto eye = target + glm::vec3(glm::sin(theta), 0.0f, glm::cos(theta)) * distance;
+        Renderer::setViewMatrix(glm::lookAt(eye, target, glm::vec3(0.0f, 1.0f, 0.0f)));
+        Renderer::setViewPos(eye);
+
+        //NOTE: opaque and cutout parts only, blended ones would need sorting
+        model.source->forEach<Mesh>([&](Mesh* mesh) {
+            if (mesh->getFrameType() != FrameType::Mesh || !mesh->isOn() || mesh->getVertices().empty()) return;
+
+            const auto local = worldToLocal * mesh->getDrawMatrix();
+            for (const auto& faceGroup : mesh->getFaceGroups()) {
+                const auto& material = faceGroup->getMaterial();
+                if (material != nullptr && material->isTransparent()) continue;
+
+                if (material != nullptr) {
+                    material->bind();
+                } else {
+                    Renderer::bindMaterial(untextured);
+                }
+
+                const auto first = Renderer::appendInstances(&local, 1);
+                if (first < 0) return;
+
+                Renderer::setFirstInstance(first);
+                Renderer::setVertexBuffer(vertexBuffer);
+                Renderer::setIndexBuffer(indexBuffer);
+                Renderer::setLights(lights.data(), lights.size());
+                Renderer::setBones(nullptr, 0);
+                Renderer::bindBuffers();
+                Renderer::applyUniforms();
+                Renderer::draw(static_cast<int>(faceGroup->getOffset()), static_cast<int>(faceGroup->getIndicesCount()), 1);
+            }
+        }, model.source);
+    }
+}
+
+void ImpostorAtlas::clear() {
+    //NOTE: instances outlive atlas on rebuild, they must not keep pointing at freed impostors
+    for (const auto& impostor : mImpostors) {
+        auto* instance = impostor->getOwner();
+        instance->forEach<Mesh>([](Mesh* mesh) { mesh->setImpostor(nullptr); }, instance);
+    }
+
+    mImpostors.clear();
+    mModels.clear();
+    mMaterial = nullptr;
+    mPending = 0;
+    mSize = 0;
+    mIsCleared = false;
+
+    if (mTexture.id != Renderer::InvalidHandle) {
+        Renderer::destroyTexture(mTexture);
+        mTexture = { Renderer::InvalidHandle };
+    }
+
+    gStats.impostorModels = 0;
+    gStats.impostorModelsCaptured = 0;
+    gStats.impostorInstances = 0;
+    gStats.impostorAtlasSize = 0;
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "mesh.hpp"
+
+class Model;
+class Sector;
+
+//NOTE: one cache.bin model captured from AngleCount directions around its up axis,
+//view of every direction is quad with own atlas cell, quads are face groups shared by all instances
+struct ImpostorModel {
+    Model* source = nullptr;
+    glm::vec3 center{ 0.0f };
+    float radius = 0.0f;
+    float minY = 0.0f;
+    float maxY = 0.0f;
+    int firstCell = 0;
+    int waitFrames = 0;
+    bool isCaptured = false;
+    std::vector<Renderer::Vertex> vertices;
+    std::vector<std::unique_ptr<FaceGroup>> faceGroups;
+};
+
+//NOTE: camera facing quad standing in for distant model instance, drawn through billboard pipeline,
+//it isn't part of frame tree, owner is model instance so quad follows it
+class Impostor : public Mesh {
+public:
+    explicit Impostor(const ImpostorModel* model);
+
+    [[nodiscard]] constexpr FrameType getFrameType() const override { return FrameType::Billboard; }
+
+    //NOTE: cull thread, instance is swapped past distance widened or narrowed by lod hysteresis
+    [[nodiscard]] bool isActive(const glm::vec3& viewPos, float distanceScale);
+
+    //NOTE: quad of captured direction nearest to direction instance is seen from
+    [[nodiscard]] FaceGroup* selectFaceGroup(const glm::vec3& viewPos);
+
+    //NOTE: every mesh of instance leads to same impostor, it is queued once per cull
+    [[nodiscard]] bool markQueued(uint64_t cullFrame);
+private:
+    const ImpostorModel* mModel;
+    uint64_t mQueuedFrame = 0;
+    bool mIsActive = false;
+};
+
+//NOTE: impostors of models placed most times, models are captured into one atlas texture
+//after their textures stream in, until then instances stay geometry
+class ImpostorAtlas {
+public:
+    static constexpr int AngleCount = 8;
+    static constexpr int CellSize = 128;
+    static constexpr int CellPadding = 2;
+    static constexpr int MaxAtlasSize = 4096;
+    static constexpr int MaxCapturesPerFrame = 4;
+    static constexpr int MaxCaptureWaitFrames = 300;
+    static constexpr float MinExtent = 0.01f;
+
+    //NOTE: models are ordered by instance count, ones not fitting atlas budget get no impostor
+    void build(const std::unordered_map<std::string, std::vector<Model*>>& instances);
+
+    //NOTE: quads go to scene geometry, face groups get their offsets
+    void appendGeometry(std::vector<Renderer::Vertex>& vertices, std::vector<uint32_t>& indices);
+
+    //NOTE: render thread outside of frame pass, captures models with streamed in textures,
+    //lit by sun and ambient of sector they are in
+    void update(Sector* sector, Renderer::BufferHandle vertexBuffer, Renderer::BufferHandle indexBuffer);
+    void clear();
+
+    [[nodiscard]] const std::shared_ptr<Material>& getMaterial() const { return mMaterial; }
+    [[nodiscard]] size_t getModelCount() const { return mModels.size(); }
+    [[nodiscard]] size_t getCapturedCount() const { return mModels.size() - mPending; }
+    [[nodiscard]] size_t getInstanceCount() const { return mImpostors.size(); }
+    [[nodiscard]] int getSize() const { return mSize; }
+
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    //NOTE: distance instances turn into impostors, scaled like lod distances
+    static void setDistance(float distance);
+    static float getDistance();
+
+    //NOTE: bytes of atlas color texture, depth exists only while capturing, applies on next load
+    static void setBudget(size_t bytes);
+    static size_t getBudget();
+private:
+    void capture(ImpostorModel& model, const std::vector<Renderer::Light>& sectorLights,
+        Renderer::BufferHandle vertexBuffer, Renderer::BufferHandle indexBuffer);
+    [[nodiscard]] bool isStreamedIn(ImpostorModel& model);
+
+    std::vector<std::unique_ptr<ImpostorModel>> mModels;
+    std::vector<std::shared_ptr<Impostor>> mImpostors;
+    std::shared_ptr<Material> mMaterial;
+    Renderer::TextureHandle mTexture{ Renderer::InvalidHandle };
+    size_t mPending = 0;
+    int mSize = 0;
+    bool mIsCleared = false;
+};
\ No newline at end of file
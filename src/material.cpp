@@ -7,28 +7,83 @@
 #include "texture.hpp"
 #include "logger.hpp"
 
-#include <sokol/sokol_time.h>
+#include <algorithm>
 
-void Material::bind() {
+//NOTE: materials with animated diffuse, updated once per frame in App::render
+static std::vector<Material*> gAnimatedMaterials;
+
+Material::~Material() {
     if (isAnimated()) {
-        if (stm_sec(stm_diff(stm_now(), mLastUpdatedAnimTex)) > mAnimationPeriod / 1000.0f) {
-            mCurrentAnimatedDiffuseIdx++;
-            if (mCurrentAnimatedDiffuseIdx >= mAnimatedTextures.size()) mCurrentAnimatedDiffuseIdx = 0;
-            mRenderMaterial.diffuseTexture = mAnimatedTextures[mCurrentAnimatedDiffuseIdx]->getTextureHandle();
-            mLastUpdatedAnimTex = stm_now();
-        }
+        gAnimatedMaterials.erase(std::remove(gAnimatedMaterials.begin(), gAnimatedMaterials.end(), this), gAnimatedMaterials.end());
+    }
+}
+
+void Material::updateAnimations(uint64_t timeMs) {
+    for (auto* material : gAnimatedMaterials) {
+        const auto& frames = material->mAnimatedTextures;
+        if (frames.empty()) continue;
+
+        const auto frameIdx = (timeMs / material->mAnimationPeriod) % frames.size();
+        material->mDiffuseTexture = frames[frameIdx];
     }
+}
+
+void Material::setAnimationPeriod(uint32_t framePeriod) {
+    if (!isAnimated() && framePeriod > 0) {
+        gAnimatedMaterials.push_back(this);
+    } else if (isAnimated() && framePeriod == 0) {
+        gAnimatedMaterials.erase(std::remove(gAnimatedMaterials.begin(), gAnimatedMaterials.end(), this), gAnimatedMaterials.end());
+    }
+
+    mAnimationPeriod = framePeriod;
+}
 
+void Material::bind() {
+    //NOTE: until texture is resident renderer binds empty texture as placeholder
+    mRenderMaterial.diffuseTexture  = mDiffuseTexture ? mDiffuseTexture->getResidentHandle() : mDiffuseHandle;
+    mRenderMaterial.envTexture      = mEnvTexture ? mEnvTexture->getResidentHandle() : std::nullopt;
+    mRenderMaterial.alphaTexture    = mAlphaTexture ? mAlphaTexture->getResidentHandle() : std::nullopt;
+    mRenderMaterial.paletteTexture  = mDiffuseTexture ? mDiffuseTexture->getResidentPaletteHandle() : std::nullopt;
     Renderer::bindMaterial(mRenderMaterial);
 }
 
+std::array<uint32_t, 4> Material::getTextureSet() const {
+    auto getId = [](const std::optional<Renderer::TextureHandle>& handle) { return handle.has_value() ? handle->id : 0u; };
+    return {
+        getId(mDiffuseTexture ? mDiffuseTexture->getResidentHandle() : mDiffuseHandle),
+        getId(mAlphaTexture ? mAlphaTexture->getResidentHandle() : std::nullopt),
+        getId(mEnvTexture ? mEnvTexture->getResidentHandle() : std::nullopt),
+        getId(mDiffuseTexture ? mDiffuseTexture->getResidentPaletteHandle() : std::nullopt)
+    };
+}
+
+void Material::requestTextureSize(float pixels) {
+    if (mDiffuseTexture) mDiffuseTexture->requestScreenSize(pixels);
+    if (mEnvTexture) mEnvTexture->requestScreenSize(pixels);
+    if (mAlphaTexture) mAlphaTexture->requestScreenSize(pixels);
+
+    for (auto* frame : mAnimatedTextures) {
+        frame->requestScreenSize(pixels);
+    }
+}
+
+bool Material::isStreamedIn() const {
+    auto isDone = [](const Texture* texture) { return texture == nullptr || texture->isResident() || texture->isFailed(); };
+    return isDone(mDiffuseTexture) && isDone(mEnvTexture) && isDone(mAlphaTexture);
+}
+
 void Material::appendAnimatedTexture(const std::string& path) {
-    mAnimatedTextures.push_back(Texture::loadFromFile(path, hasTransparencyKey()));
+    if(auto frame = Texture::loadFromFile(path, hasTransparencyKey(), false, Texture::isPalettedEnabled())) {
+        mAnimatedTextures.push_back(frame);
+    } else {
+        Logger::get().error("unable to create animated texture: {} for material", path);
+    }
 }
 
 void Material::createDiffuseTexture(const std::string& path) {
-    if(auto diffuse = Texture::loadFromFile(path, hasTransparencyKey(), mHasMipmaps)) {
-        mRenderMaterial.diffuseTexture = diffuse->getTextureHandle();
+    //NOTE: only diffuse is paletted, mipmapped materials fall back to RGBA
+    if(auto diffuse = Texture::loadFromFile(path, hasTransparencyKey(), mHasMipmaps, Texture::isPalettedEnabled())) {
+        mDiffuseTexture = diffuse;
     } else {
         Logger::get().error("unable to create diffsue texture: {} for material", path);
     }
@@ -36,7 +91,7 @@ void Material::createDiffuseTexture(const std::string& path) {
 
 void Material::createEnvTexture(const std::string& path) {
     if(auto env = Texture::loadFromFile(path, hasTransparencyKey())) {
-        mRenderMaterial.envTexture = env->getTextureHandle();
+        mEnvTexture = env;
     } else {
         Logger::get().error("unable to create env texture: {} for material", path);
     }
@@ -44,7 +99,7 @@ void Material::createEnvTexture(const std::string& path) {
 
 void Material::createAlphaTexture(const std::string& path) {
     if(auto alpha = Texture::loadFromFile(path, hasTransparencyKey())) {
-        mRenderMaterial.alphaTexture = alpha->getTextureHandle();
+        mAlphaTexture = alpha;
     } else {
         Logger::get().error("unable to create alpha texture: {} for material", path);
     }
@@ -6,25 +6,47 @@
 #include <glm/glm.hpp>
 #include <memory>
 #include <vector>
+#include <array>
 #include <string>
+#include <optional>
 
 #include "renderer.hpp"
 
 class Texture;
 class Material {
 public:
+    //NOTE: animated materials are registered by address, materials live in shared_ptr only
+    Material() = default;
+    Material(const Material&) = delete;
+    Material& operator=(const Material&) = delete;
+    Material(Material&&) = delete;
+    Material& operator=(Material&&) = delete;
+    ~Material();
     void bind();
+
+    //NOTE: advances all animated materials from one per frame time value
+    static void updateAnimations(uint64_t timeMs);
     
     void createDiffuseTexture(const std::string& path);
-    [[nodiscard]] std::optional<Renderer::TextureHandle> getDiffuseTexture() const { return mRenderMaterial.diffuseTexture; }
+    [[nodiscard]] Texture* getDiffuseTexture() const { return mDiffuseTexture; }
 
     void createEnvTexture(const std::string& path);
-    [[nodiscard]] std::optional<Renderer::TextureHandle> getEnvTexture() const { return mRenderMaterial.envTexture; }
+    [[nodiscard]] Texture* getEnvTexture() const { return mEnvTexture; }
      
     void createAlphaTexture(const std::string& path);
-    [[nodiscard]] std::optional<Renderer::TextureHandle> getAlphaTexture() const { return mRenderMaterial.alphaTexture; }
+    [[nodiscard]] Texture* getAlphaTexture() const { return mAlphaTexture; }
+
+    //NOTE: diffuse rendered on GPU ( impostor atlas ), used when there is no diffuse texture
+    void setDiffuseHandle(Renderer::TextureHandle handle) { mDiffuseHandle = handle; }
 
     void appendAnimatedTexture(const std::string& path);
+    void requestTextureSize(float pixels);
+
+    //NOTE: every texture is resident or failed to load, material looks as it will
+    [[nodiscard]] bool isStreamedIn() const;
+
+    //NOTE: GPU handles bound by this material this frame ( diffuse, alpha, env, palette ), 0 for placeholder
+    [[nodiscard]] std::array<uint32_t, 4> getTextureSet() const;
     
     void setAmbient(const glm::vec3& color) { mRenderMaterial.ambient = color; }
     [[nodiscard]] const glm::vec3& getAmbient() const { return mRenderMaterial.ambient; }
@@ -56,18 +78,21 @@ public:
     void setColored(bool val) { mRenderMaterial.isColored = val; }
     [[nodiscard]] bool isColored() const { return mRenderMaterial.isColored; }
 
-    void setAnimationPeriod(uint32_t framePeriod) { mAnimationPeriod = framePeriod; }
+    void setAnimationPeriod(uint32_t framePeriod);
     [[nodiscard]] bool isAnimated() const { return mAnimationPeriod > 0; }
     
     void setMipmaps(bool mipmaps) { mHasMipmaps = mipmaps; }
     [[nodiscard]] bool hasMipmaps() const { return mHasMipmaps; }
 
-    [[nodiscard]] bool isTransparent() const { return mRenderMaterial.transparency < 1.0f || mRenderMaterial.alphaTexture.has_value(); }
+    [[nodiscard]] bool isTransparent() const { return mRenderMaterial.transparency < 1.0f || mAlphaTexture != nullptr; }
 private:
     Renderer::Material mRenderMaterial{};
+    //NOTE: textures are streamed in, handles are resolved on bind
+    Texture* mDiffuseTexture = nullptr;
+    Texture* mEnvTexture = nullptr;
+    Texture* mAlphaTexture = nullptr;
+    std::optional<Renderer::TextureHandle> mDiffuseHandle;
     std::vector<Texture*> mAnimatedTextures;
     uint32_t mAnimationPeriod           = 0;
-    size_t mCurrentAnimatedDiffuseIdx   = 0;
-    uint64_t mLastUpdatedAnimTex        = 0;
     bool mHasMipmaps = false;
 };
\ No newline at end of file
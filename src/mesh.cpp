@@ -15,6 +15,13 @@ void FaceGroup::render() const {
         mMaterial->bind();
     }
 
+    if(auto mesh = mMesh.lock()) {
+        const auto model = mesh->getDrawMatrix();
+        const auto first = Renderer::appendInstances(&model, 1);
+        if(first < 0) return;
+        Renderer::setFirstInstance(first);
+    }
+
     Renderer::bindBuffers();
     Renderer::applyUniforms();
     Renderer::draw(static_cast<int>(mOffset), static_cast<int>(mIndicesCount), 1);
@@ -28,7 +35,7 @@ void Mesh::setVertices(std::vector<Renderer::Vertex> vertices) {
     mVertices = std::move(vertices);
 
     glm::vec3 AABBmin = glm::vec3(std::numeric_limits<float>::max());
-	glm::vec3 AABBmax = glm::vec3(std::numeric_limits<float>::min());
+	glm::vec3 AABBmax = glm::vec3(std::numeric_limits<float>::lowest());
 
     for (const auto& vertex : mVertices) {
         AABBmin = glm::min(AABBmin, vertex.p);
@@ -38,11 +45,67 @@ void Mesh::setVertices(std::vector<Renderer::Vertex> vertices) {
     setBBOX(std::make_pair(AABBmin, AABBmax));
 }
 
+void Mesh::addLod(float distance, std::vector<Renderer::Vertex> vertices, std::vector<std::unique_ptr<FaceGroup>> faceGroups) {
+    Lod lod;
+    lod.distance = distance;
+    lod.vertices = std::move(vertices);
+    lod.faceGroups = std::move(faceGroups);
+    mLods.push_back(std::move(lod));
+}
+
+size_t Mesh::selectLod(float distance) {
+    const auto lodCount = getLodCount();
+    mLod = std::min(mLod, lodCount - 1);
+
+    while (mLod + 1 < lodCount && distance > getLodDistance(mLod) * (1.0f + LodHysteresis)) {
+        mLod++;
+    }
+
+    while (mLod > 0 && distance < getLodDistance(mLod - 1) * (1.0f - LodHysteresis)) {
+        mLod--;
+    }
+
+    return mLod;
+}
+
+void Mesh::setBaked(const glm::mat4& bakedWorld) {
+    mBakedWorld = bakedWorld;
+    mIsBaked = true;
+}
+
+bool Mesh::isBakedInPlace() {
+    return mIsBaked && getWorldMatrix() == mBakedWorld;
+}
+
+glm::mat4 Mesh::getDrawMatrix() {
+    if (!mIsBaked) {
+        return getWorldMatrix();
+    }
+
+    //NOTE: moved after bake ( gizmo ), apply only difference to baked vertices
+    if (isBakedInPlace()) {
+        return glm::mat4(1.0f);
+    }
+
+    return getWorldMatrix() * glm::inverse(mBakedWorld);
+}
+
 void Mesh::render() {
-    Frame::render();
-    
+    if (!isOn()) return;
+
+    uint32_t parentMask;
+    if (!beginSubtree(parentMask)) return;
+    renderChilds();
+
+    if (!mVertices.empty() && isVisible()) {
+        renderVisible();
+    }
+
+    endSubtree(parentMask);
+}
+
+void Mesh::renderVisible() {
     if (mVertices.empty() || !isOn()) return;
-    if(!isVisible()) return;
 
     if(mUpdateLights) {
         updateLights();
@@ -51,7 +114,6 @@ void Mesh::render() {
 
     App::get()->getScene()->addToRenderList(this);
     /*Renderer::setLights(mLights);
-    Renderer::setModel(getWorldMatrix());
 
     for (auto& faceGroup : mFaceGroups) {
         faceGroup->render();
@@ -137,4 +199,14 @@ void Mesh::updateLights() {
     });
 
     mLights.resize(15);
+
+    //NOTE: lights are summed in shader so order doesn't matter after picking nearest ones,
+    //canonical order lets meshes with same light set share draw
+    auto lightOrder = [](const Renderer::Light& a, const Renderer::Light& b) {
+        if (a.type != b.type) return a.type < b.type;
+        if (a.position.x != b.position.x) return a.position.x < b.position.x;
+        if (a.position.y != b.position.y) return a.position.y < b.position.y;
+        return a.position.z < b.position.z;
+    };
+    std::stable_sort(mLights.begin(), mLights.end(), lightOrder);
 }
\ No newline at end of file
@@ -4,9 +4,11 @@
 
 #include <vector>
 #include <memory>
+#include <string>
 
 class Mesh;
 class Material;
+class Impostor;
 
 class FaceGroup {
 public:
@@ -23,11 +25,18 @@ public:
 
     const std::vector<uint16_t>& getIndices() { return mIndices; }
     void setOffset(size_t offset) { mOffset = offset; }
+    [[nodiscard]] size_t getOffset() const { return mOffset; }
+    [[nodiscard]] size_t getIndicesCount() const { return mIndicesCount; }
+
+    //NOTE: id of static batch ( sector + material ) face group was baked into, 0 when not baked
+    void setStaticBatch(uint32_t batch) { mStaticBatch = batch; }
+    [[nodiscard]] uint32_t getStaticBatch() const { return mStaticBatch; }
 
     void render() const;
 private:
     size_t mOffset = 0;
     size_t mIndicesCount = 0;
+    uint32_t mStaticBatch = 0;
     std::weak_ptr<Mesh> mMesh;
     std::vector<uint16_t> mIndices;
     std::shared_ptr<Material> mMaterial;
@@ -40,18 +49,82 @@ public:
     void setVertices(std::vector<Renderer::Vertex> vertices);
     [[nodiscard]] const std::vector<Renderer::Vertex>& getVertices () { return mVertices; }
 
+    //NOTE: meshes loaded from same model file share key, their geometry is uploaded once
+    void setGeometryKey(std::string key) { mGeometryKey = std::move(key); }
+    [[nodiscard]] const std::string& getGeometryKey() const { return mGeometryKey; }
+
     void addFaceGroup(std::unique_ptr<FaceGroup> faceGroup) { mFaceGroups.push_back(std::move(faceGroup)); }
     [[nodiscard]] const std::vector<std::unique_ptr<FaceGroup>>& getFaceGroups() { return mFaceGroups; }
 
+    //NOTE: 4DS lod chain, lod 0 are vertices and face groups above, lod i is drawn
+    //up to its distance, last one has no end
+    static constexpr float LodHysteresis = 0.1f;
+    void setLodDistance(float distance) { mLodDistance = distance; }
+    void addLod(float distance, std::vector<Renderer::Vertex> vertices, std::vector<std::unique_ptr<FaceGroup>> faceGroups);
+    [[nodiscard]] size_t getLodCount() const { return mLods.size() + 1; }
+    [[nodiscard]] float getLodDistance(size_t lod) const { return lod == 0 ? mLodDistance : mLods[lod - 1].distance; }
+    [[nodiscard]] const std::vector<Renderer::Vertex>& getLodVertices(size_t lod) { return lod == 0 ? mVertices : mLods[lod - 1].vertices; }
+    [[nodiscard]] const std::vector<std::unique_ptr<FaceGroup>>& getLodFaceGroups(size_t lod) { return lod == 0 ? mFaceGroups : mLods[lod - 1].faceGroups; }
+
+    //NOTE: picks lod for distance, coarser lod is taken only past its distance widened by hysteresis
+    //and finer back only when closer than narrowed one, so lod doesn't flicker on the edge
+    size_t selectLod(float distance);
+    [[nodiscard]] size_t getLod() const { return mLod; }
+
     [[nodiscard]] const std::vector<Renderer::Light>& getLights() { return mLights; }
 
+    //NOTE: skinning palette for this frame, empty for static meshes
+    [[nodiscard]] const std::vector<glm::mat4>& getBoneMatrices() const { return mBoneMatrices; }
+
+    //NOTE: static meshes ( scene.4ds, cache.bin ) are candidates for static batching
+    void setStatic(bool isStatic) { mIsStatic = isStatic; }
+    [[nodiscard]] bool isStatic() const { return mIsStatic; }
+
+    //NOTE: static meshes are numbered for mission PVS
+    static constexpr uint32_t NoPvsIndex = UINT32_MAX;
+    void setPvsIndex(uint32_t index) { mPvsIndex = index; }
+    [[nodiscard]] uint32_t getPvsIndex() const { return mPvsIndex; }
+
+    //NOTE: far away mesh of cache.bin model is replaced by impostor of model instance
+    void setImpostor(Impostor* impostor) { mImpostor = impostor; }
+    [[nodiscard]] Impostor* getImpostor() const { return mImpostor; }
+
+    //NOTE: baked meshes have vertices in world space, bakedWorld is world matrix used for baking
+    void setBaked(const glm::mat4& bakedWorld);
+    [[nodiscard]] bool isBaked() const { return mIsBaked; }
+    [[nodiscard]] bool isBakedInPlace();
+
+    //NOTE: matrix for instance buffer, identity for baked meshes which didn't move since bake
+    [[nodiscard]] glm::mat4 getDrawMatrix();
+
     virtual void render() override;
+
+    //NOTE: mesh passed culling, updates what it needs for this frame and goes to render list
+    virtual void renderVisible();
+protected:
+    std::vector<glm::mat4> mBoneMatrices;
+    std::vector<Renderer::Light> mLights;
+    bool mUpdateLights = true;
 private:
     //NOTE: batch ligts for this mesh from current sector
     void updateLights();
-    std::vector<Renderer::Light> mLights;
-    bool mUpdateLights = true;
 
+    std::string mGeometryKey;
+    glm::mat4 mBakedWorld{ 1.0f };
+    bool mIsStatic = false;
+    uint32_t mPvsIndex = NoPvsIndex;
+    Impostor* mImpostor = nullptr;
+    bool mIsBaked = false;
     std::vector<Renderer::Vertex> mVertices;
     std::vector<std::unique_ptr<FaceGroup>> mFaceGroups;
+
+    struct Lod {
+        float distance = 0.0f;
+        std::vector<Renderer::Vertex> vertices;
+        std::vector<std::unique_ptr<FaceGroup>> faceGroups;
+    };
+
+    float mLodDistance = 0.0f;
+    size_t mLod = 0;
+    std::vector<Lod> mLods;
 };
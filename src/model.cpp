@@ -6,7 +6,7 @@
 #include <unordered_map>
 
 void Model::render() {
-    if(!isVisible()) return;
+    //NOTE: model box is part of subtree bounds Frame::render tests
     //Renderer::setModel(getMatrix());
     Frame::render();
 }
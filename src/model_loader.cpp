@@ -18,6 +18,11 @@
 #include "vfs.hpp"
 
 #include <filesystem>
+#include <unordered_map>
+
+//NOTE: instances of same model share materials ( and geometry, see Scene::initVertexBuffers )
+//so render queue can merge their draws into instanced ones
+static std::unordered_map<std::string, std::weak_ptr<Material>> gMaterialCache;
 
 [[nodiscard]] std::vector<std::string> makeAnimationNames(const std::string& baseFileName, unsigned int frames) {
     std::vector<std::string> result;
@@ -128,8 +133,26 @@
     return material;
 }
 
+[[nodiscard]] std::shared_ptr<Material> getSharedMaterial(const std::string& modelPath, 
+    const std::vector<MFFormat::DataFormat4DS::Material>& materials, size_t materialIdx, bool isBillboard) {
+    const auto key = modelPath + "#" + std::to_string(materialIdx) + (isBillboard ? "#billboard" : "");
+    if (auto cached = gMaterialCache[key].lock()) {
+        return cached;
+    }
+
+    auto loadedMat = loadMaterial(materials[materialIdx]);
+    
+    //NOTE: set material kind to billboard
+    if (isBillboard) {
+        loadedMat->setKind(Renderer::MaterialKind::BILLBOARD);
+    }
+
+    gMaterialCache[key] = loadedMat;
+    return loadedMat;
+}
+
 std::shared_ptr<Mesh> loadStandard(MFFormat::DataFormat4DS::Mesh& mesh,
-    const std::vector<MFFormat::DataFormat4DS::Material>& materials) {
+    const std::vector<MFFormat::DataFormat4DS::Material>& materials, const std::string& geometryKey, const std::string& modelPath) {
     std::vector<MFFormat::DataFormat4DS::Lod>* lods = nullptr;
     std::shared_ptr<Mesh> newMesh = nullptr;
     switch (mesh.mVisualMeshType) {
@@ -173,12 +196,9 @@ std::shared_ptr<Mesh> loadStandard(MFFormat::DataFormat4DS::Mesh& mesh,
         return newMesh;
     }
 
-    auto& lod = lods->at(0);
-
     // NOTE: get vertices from lod
-    std::vector<Renderer::Vertex> vertices;
-    {
-        
+    auto loadLodVertices = [](const MFFormat::DataFormat4DS::Lod& lod) {
+        std::vector<Renderer::Vertex> vertices;
         for (const auto& mafiaVertex : lod.mVertices) {
             Renderer::Vertex vertex{};
             vertex.p = { mafiaVertex.mPos.x, mafiaVertex.mPos.y, mafiaVertex.mPos.z };
@@ -186,10 +206,12 @@ std::shared_ptr<Mesh> loadStandard(MFFormat::DataFormat4DS::Mesh& mesh,
             vertex.uv = { mafiaVertex.mUV.x, mafiaVertex.mUV.y * -1.0f };
             vertices.push_back(vertex);
         }
-    }
+        return vertices;
+    };
 
     //NOTE: load face groups
-    {
+    auto loadLodFaceGroups = [&](const MFFormat::DataFormat4DS::Lod& lod) {
+        std::vector<std::unique_ptr<FaceGroup>> faceGroups;
         for (const auto& mafiaFaceGroup : lod.mFaceGroups) {
             std::vector<uint16_t> indices;
             for (const auto& face : mafiaFaceGroup.mFaces) {
@@ -200,16 +222,28 @@ std::shared_ptr<Mesh> loadStandard(MFFormat::DataFormat4DS::Mesh& mesh,
 
             auto faceGroup = std::make_unique<FaceGroup>(indices, newMesh);
             if (mafiaFaceGroup.mMaterialID > 0) {
-                auto loadedMat = loadMaterial(materials[mafiaFaceGroup.mMaterialID - 1]);
-                
-                //NOTE: set material kind to billboard
-                if (newMesh->getFrameType() == FrameType::Billboard) {
-                    loadedMat->setKind(Renderer::MaterialKind::BILLBOARD);
-                }
-
-                faceGroup->setMaterial(std::move(loadedMat));
+                const bool isBillboard = newMesh->getFrameType() == FrameType::Billboard;
+                faceGroup->setMaterial(getSharedMaterial(modelPath, materials, mafiaFaceGroup.mMaterialID - 1, isBillboard));
             }
-            newMesh->addFaceGroup(std::move(faceGroup));
+            faceGroups.push_back(std::move(faceGroup));
+        }
+        return faceGroups;
+    };
+
+    auto& lod = lods->at(0);
+    auto vertices = loadLodVertices(lod);
+    for (auto& faceGroup : loadLodFaceGroups(lod)) {
+        newMesh->addFaceGroup(std::move(faceGroup));
+    }
+
+    //NOTE: coarser lods of static geometry, skinned meshes carry bones per lod and stay on first one
+    newMesh->setLodDistance(lod.mRelativeDistance);
+    if (newMesh->getFrameType() != FrameType::SingleMesh) {
+        auto lodDistance = lod.mRelativeDistance;
+        for (size_t i = 1; i < lods->size(); i++) {
+            const auto& coarserLod = lods->at(i);
+            lodDistance = std::max(lodDistance, coarserLod.mRelativeDistance);
+            newMesh->addLod(lodDistance, loadLodVertices(coarserLod), loadLodFaceGroups(coarserLod));
         }
     }
 
@@ -267,6 +301,7 @@ std::shared_ptr<Mesh> loadStandard(MFFormat::DataFormat4DS::Mesh& mesh,
     }
 
     newMesh->setVertices(vertices);
+    newMesh->setGeometryKey(geometryKey);
     return newMesh;
 }
 
@@ -307,6 +342,33 @@ std::shared_ptr<Mesh> loadStandard(MFFormat::DataFormat4DS::Mesh& mesh,
     auto bbox = std::make_pair<glm::vec3, glm::vec3>({mesh.mSector.mMinBox.x, mesh.mSector.mMinBox.y, mesh.mSector.mMinBox.z},
                                                     {mesh.mSector.mMaxBox.x, mesh.mSector.mMaxBox.y, mesh.mSector.mMaxBox.z});
     newMesh->setBBOX(bbox);
+
+    //NOTE: portal vertices are in sector space, moved to world once scene is linked
+    std::vector<Sector::Portal> portals;
+    for (const auto& mafiaPortal : mesh.mSector.mPortals) {
+        Sector::Portal portal;
+        for (const auto& vertex : mafiaPortal.mVertices) {
+            portal.vertices.emplace_back(vertex.x, vertex.y, vertex.z);
+        }
+
+        if (portal.vertices.size() >= 3) {
+            portals.push_back(std::move(portal));
+        }
+    }
+
+    newMesh->setPortals(std::move(portals));
+
+    std::vector<glm::vec3> hullVertices;
+    for (const auto& vertex : mesh.mSector.mVertices) {
+        hullVertices.emplace_back(vertex.x, vertex.y, vertex.z);
+    }
+
+    std::vector<glm::u16vec3> hullFaces;
+    for (const auto& face : mesh.mSector.mFaces) {
+        hullFaces.emplace_back(face.mA, face.mB, face.mC);
+    }
+
+    newMesh->setHull(hullVertices, hullFaces);
     return newMesh;
 }
 
@@ -330,10 +392,11 @@ std::shared_ptr<Mesh> loadStandard(MFFormat::DataFormat4DS::Mesh& mesh,
     return newMesh;
 }
 
-std::shared_ptr<Frame> meshFactory(MFFormat::DataFormat4DS::Mesh& mesh, const std::vector<MFFormat::DataFormat4DS::Material>& materials) {
+std::shared_ptr<Frame> meshFactory(MFFormat::DataFormat4DS::Mesh& mesh, const std::vector<MFFormat::DataFormat4DS::Material>& materials, 
+    const std::string& modelPath, size_t meshIdx) {
     switch (mesh.mMeshType) {
         case MFFormat::DataFormat4DS::MeshType::MESHTYPE_STANDARD: {
-            return loadStandard(mesh, materials);
+            return loadStandard(mesh, materials, modelPath + "#" + std::to_string(meshIdx), modelPath);
         } break;
 
         case MFFormat::DataFormat4DS::MeshType::MESHTYPE_SECTOR: {
@@ -377,8 +440,8 @@ std::shared_ptr<Model> ModelLoader::loadModel(const std::string& path, const std
 
     // NOTE: linear loading of meshes
     std::vector<std::shared_ptr<Frame>> loadedMeshes;
-    for (auto& mesh : parserModel.mMeshes) {
-        auto loadedMesh = meshFactory(mesh, parserModel.mMaterials);
+    for (size_t i = 0; i < parserModel.mMeshes.size(); i++) {
+        auto loadedMesh = meshFactory(parserModel.mMeshes[i], parserModel.mMaterials, path, i);
         if (loadedMesh) {
             loadedMeshes.push_back(loadedMesh);
         }
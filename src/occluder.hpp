@@ -0,0 +1,10 @@
+#pragma once
+#include "frame.hpp"
+
+//NOTE: scene2.bin occluder, invisible box which hides what is behind it,
+//unit cube scaled by frame transform
+class Occluder : public Frame {
+public:
+    Occluder() { setBBOX({ glm::vec3(-0.5f), glm::vec3(0.5f) }); }
+    [[nodiscard]] constexpr FrameType getFrameType() const override { return FrameType::Occluder; }
+};
\ No newline at end of file
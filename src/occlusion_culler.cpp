@@ -0,0 +1,340 @@
+#include "occlusion_culler.hpp"
+#include "mesh.hpp"
+#include "material.hpp"
+#include "simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+//NOTE: triangles are clipped to this w, projection of anything closer blows up
+constexpr float NearW = 0.05f;
+
+static_assert(OcclusionCuller::Width % OcclusionCuller::TileWidth == 0 && OcclusionCuller::Height % OcclusionCuller::TileHeight == 0, "tiles have to cover depth buffer");
+static_assert(OcclusionCuller::TileWidth % 4 == 0, "tile rows are rasterized 4 pixels at once");
+
+OcclusionCuller::~OcclusionCuller() {
+    {
+        std::lock_guard<std::mutex> lock(mWorkers.mutex);
+        mWorkers.stop = true;
+    }
+
+    mWorkers.wakeUp.notify_all();
+    for (auto& thread : mWorkers.threads) {
+        thread.join();
+    }
+}
+
+void OcclusionCuller::begin(const glm::mat4& viewProj) {
+    mViewProj = viewProj;
+    mTriangles.clear();
+    for (auto& tileTriangles : mTileTriangles) {
+        tileTriangles.clear();
+    }
+
+    std::fill(mDepth.begin(), mDepth.end(), 0.0f);
+    mOccluderCount = 0;
+}
+
+bool OcclusionCuller::isOccluderCandidate(Mesh* mesh) {
+    if (mesh->getFrameType() != FrameType::Mesh || !mesh->isStatic() || mesh->getVertices().empty()) return false;
+
+    size_t trianglesCount = 0;
+    for (const auto& faceGroup : mesh->getFaceGroups()) {
+        const auto& material = faceGroup->getMaterial();
+        if (material == nullptr || material->isTransparent()) return false;
+
+        //NOTE: env map overrides kind of color keyed material, so key is checked on its own,
+        //double sided faces are thin cutout geometry ( fences, foliage ) which doesn't hide anything
+        if (material->hasTransparencyKey() || material->isDoubleSided()) return false;
+
+        const auto kind = material->getKind();
+        if (kind == Renderer::MaterialKind::CUTOUT) return false;
+        if (kind != Renderer::MaterialKind::DIFFUSE && kind != Renderer::MaterialKind::ENV) return false;
+
+        trianglesCount += faceGroup->getIndicesCount() / 3;
+    }
+
+    return trianglesCount > 0 && trianglesCount <= MaxOccluderTriangles;
+}
+
+bool OcclusionCuller::addOccluder(Mesh* mesh) {
+    if (mOccluderCount >= MaxOccluders || !isOccluderCandidate(mesh)) return false;
+
+    size_t trianglesCount = 0;
+    for (const auto& faceGroup : mesh->getFaceGroups()) {
+        trianglesCount += faceGroup->getIndicesCount() / 3;
+    }
+
+    if (mTriangles.size() + trianglesCount > MaxTriangles) return false;
+
+    //NOTE: baked meshes keep vertices in world space, draw matrix accounts for that
+    const auto toClip = mViewProj * mesh->getDrawMatrix();
+    const auto& vertices = mesh->getVertices();
+    for (const auto& faceGroup : mesh->getFaceGroups()) {
+        const bool doubleSided = faceGroup->getMaterial()->isDoubleSided();
+        const auto& indices = faceGroup->getIndices();
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            addTriangle(toClip * glm::vec4(vertices[indices[i]].p, 1.0f), 
+                        toClip * glm::vec4(vertices[indices[i + 1]].p, 1.0f), 
+                        toClip * glm::vec4(vertices[indices[i + 2]].p, 1.0f), doubleSided);
+        }
+    }
+
+    mOccluderCount++;
+    return true;
+}
+
+void OcclusionCuller::addOccluderBox(const glm::mat4& world, const AABB& box) {
+    constexpr int BoxTriangles = 12;
+    if (mTriangles.size() + BoxTriangles > MaxTriangles) return;
+
+    constexpr int faces[BoxTriangles][3] = {
+        { 0, 1, 3 }, { 0, 3, 2 }, { 4, 6, 7 }, { 4, 7, 5 },
+        { 0, 4, 5 }, { 0, 5, 1 }, { 2, 3, 7 }, { 2, 7, 6 },
+        { 0, 2, 6 }, { 0, 6, 4 }, { 1, 5, 7 }, { 1, 7, 3 },
+    };
+
+    const auto toClip = mViewProj * world;
+    std::array<glm::vec4, 8> corners;
+    for (auto i = 0; i < 8; i++) {
+        const glm::vec3 corner(i & 1 ? box.second.x : box.first.x, i & 2 ? box.second.y : box.first.y, i & 4 ? box.second.z : box.first.z);
+        corners[i] = toClip * glm::vec4(corner, 1.0f);
+    }
+
+    //NOTE: box is closed, back faces lie behind front ones so winding doesn't matter
+    for (const auto& face : faces) {
+        addTriangle(corners[face[0]], corners[face[1]], corners[face[2]], true);
+    }
+
+    mOccluderCount++;
+}
+
+void OcclusionCuller::addTriangle(const glm::vec4& v0, const glm::vec4& v1, const glm::vec4& v2, bool doubleSided) {
+    if (v0.w >= NearW && v1.w >= NearW && v2.w >= NearW) {
+        setupTriangle(v0, v1, v2, doubleSided);
+        return;
+    }
+
+    //NOTE: clip by near plane in clip space, leaves polygon of up to 4 vertices
+    const glm::vec4 input[3] = { v0, v1, v2 };
+    std::array<glm::vec4, 4> polygon;
+    int count = 0;
+    for (auto i = 0; i < 3; i++) {
+        const auto& a = input[i];
+        const auto& b = input[(i + 1) % 3];
+        if (a.w >= NearW) {
+            polygon[count++] = a;
+        }
+        if ((a.w >= NearW) != (b.w >= NearW)) {
+            polygon[count++] = a + (b - a) * ((NearW - a.w) / (b.w - a.w));
+        }
+    }
+
+    for (auto i = 1; i + 1 < count; i++) {
+        setupTriangle(polygon[0], polygon[i], polygon[i + 1], doubleSided);
+    }
+}
+
+void OcclusionCuller::setupTriangle(const glm::vec4& v0, const glm::vec4& v1, const glm::vec4& v2, bool doubleSided) {
+    if (mTriangles.size() >= MaxTriangles) return;
+
+    //NOTE: screen has y down, depth is 1 / w which is linear in screen space, bigger is nearer
+    auto toScreen = [](const glm::vec4& v) {
+        const auto invW = 1.0f / v.w;
+        return glm::vec3((v.x * invW * 0.5f + 0.5f) * Width, (0.5f - v.y * invW * 0.5f) * Height, invW);
+    };
+
+    auto p0 = toScreen(v0);
+    auto p1 = toScreen(v1);
+    auto p2 = toScreen(v2);
+
+    //NOTE: front faces are clockwise in NDC ( sokol default ), that's positive area with y down
+    auto area = (p1.x - p0.x) * (p2.y - p0.y) - (p2.x - p0.x) * (p1.y - p0.y);
+    if (area < 0.0f && doubleSided) {
+        std::swap(p1, p2);
+        area = -area;
+    }
+
+    if (!(area > 0.0f)) return;
+
+    Triangle triangle;
+    triangle.minX = std::max(0, static_cast<int>(std::floor(std::min({ p0.x, p1.x, p2.x }))));
+    triangle.minY = std::max(0, static_cast<int>(std::floor(std::min({ p0.y, p1.y, p2.y }))));
+    triangle.maxX = std::min(Width - 1, static_cast<int>(std::ceil(std::max({ p0.x, p1.x, p2.x }))));
+    triangle.maxY = std::min(Height - 1, static_cast<int>(std::ceil(std::max({ p0.y, p1.y, p2.y }))));
+    if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY) return;
+
+    //NOTE: edge functions are evaluated at pixel centers like on GPU, pixels fully inside
+    //only would leave cracks along edges shared by triangles of one occluder
+    const glm::vec3 points[3] = { p0, p1, p2 };
+    for (auto i = 0; i < 3; i++) {
+        const auto& a = points[i];
+        const auto& b = points[(i + 1) % 3];
+        const auto edgeX = a.y - b.y;
+        const auto edgeY = b.x - a.x;
+        auto constant = -(edgeX * a.x + edgeY * a.y);
+        constant += 0.5f * edgeX + 0.5f * edgeY;
+        triangle.edges[i] = glm::vec3(edgeX, edgeY, constant);
+    }
+
+    //NOTE: depth plane at pixel center lowered by half of its gradient, farthest depth over the pixel
+    const auto depthX = ((p1.z - p0.z) * (p2.y - p0.y) - (p2.z - p0.z) * (p1.y - p0.y)) / area;
+    const auto depthY = ((p2.z - p0.z) * (p1.x - p0.x) - (p1.z - p0.z) * (p2.x - p0.x)) / area;
+    auto depthConstant = p0.z - depthX * p0.x - depthY * p0.y;
+    depthConstant += 0.5f * depthX + 0.5f * depthY;
+    depthConstant -= 0.5f * (std::abs(depthX) + std::abs(depthY));
+    triangle.depth = glm::vec3(depthX, depthY, depthConstant);
+
+    const auto index = static_cast<uint32_t>(mTriangles.size());
+    mTriangles.push_back(triangle);
+    for (auto tileY = triangle.minY / TileHeight; tileY <= triangle.maxY / TileHeight; tileY++) {
+        for (auto tileX = triangle.minX / TileWidth; tileX <= triangle.maxX / TileWidth; tileX++) {
+            mTileTriangles[tileY * TilesX + tileX].push_back(index);
+        }
+    }
+}
+
+void OcclusionCuller::rasterize() {
+    mNextTile = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(mWorkers.mutex);
+        if (mWorkers.threads.empty()) {
+            const auto workersCount = std::clamp(std::thread::hardware_concurrency(), 2u, 5u) - 1;
+            for (unsigned int i = 0; i < workersCount; i++) {
+                mWorkers.threads.emplace_back(&OcclusionCuller::workerLoop, this, mWorkers.generation);
+            }
+        }
+
+        mWorkers.generation++;
+        mWorkers.active = static_cast<unsigned int>(mWorkers.threads.size());
+    }
+
+    //NOTE: calling thread takes tiles too
+    mWorkers.wakeUp.notify_all();
+    rasterizeTiles();
+
+    std::unique_lock<std::mutex> lock(mWorkers.mutex);
+    mWorkers.done.wait(lock, [this]() { return mWorkers.active == 0; });
+}
+
+//NOTE: generation is the one thread was created at, first bump after it is its first job
+void OcclusionCuller::workerLoop(uint64_t generation) {
+    std::unique_lock<std::mutex> lock(mWorkers.mutex);
+    for (;;) {
+        mWorkers.wakeUp.wait(lock, [&]() { return mWorkers.stop || mWorkers.generation != generation; });
+        if (mWorkers.stop) return;
+
+        generation = mWorkers.generation;
+        lock.unlock();
+        rasterizeTiles();
+        lock.lock();
+
+        if (--mWorkers.active == 0) {
+            mWorkers.done.notify_all();
+        }
+    }
+}
+
+void OcclusionCuller::rasterizeTiles() {
+    for (auto tile = mNextTile++; tile < TileCount; tile = mNextTile++) {
+        rasterizeTile(tile);
+    }
+}
+
+//NOTE: tiles don't share pixels, threads write without locking
+void OcclusionCuller::rasterizeTile(int tile) {
+    const auto tileMinX = (tile % TilesX) * TileWidth;
+    const auto tileMinY = (tile / TilesX) * TileHeight;
+    const auto tileMaxX = tileMinX + TileWidth - 1;
+    const auto tileMaxY = tileMinY + TileHeight - 1;
+
+    for (const auto index : mTileTriangles[tile]) {
+        const auto& triangle = mTriangles[index];
+        const auto minX = std::max(triangle.minX, tileMinX) & ~3;
+        const auto maxX = std::min(triangle.maxX, tileMaxX);
+        const auto minY = std::max(triangle.minY, tileMinY);
+        const auto maxY = std::min(triangle.maxY, tileMaxY);
+
+        for (auto y = minY; y <= maxY; y++) {
+            const auto fy = static_cast<float>(y);
+            const auto rowEdge0 = triangle.edges[0].y * fy + triangle.edges[0].z;
+            const auto rowEdge1 = triangle.edges[1].y * fy + triangle.edges[1].z;
+            const auto rowEdge2 = triangle.edges[2].y * fy + triangle.edges[2].z;
+            const auto rowDepth = triangle.depth.y * fy + triangle.depth.z;
+            auto* row = &mDepth[y * Width];
+
+#if defined(CULL_SSE)
+            const auto lanes = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+            const auto edgeX0 = _mm_set1_ps(triangle.edges[0].x);
+            const auto edgeX1 = _mm_set1_ps(triangle.edges[1].x);
+            const auto edgeX2 = _mm_set1_ps(triangle.edges[2].x);
+            const auto depthX = _mm_set1_ps(triangle.depth.x);
+            const auto zero = _mm_setzero_ps();
+            for (auto x = minX; x <= maxX; x += 4) {
+                const auto px = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), lanes);
+                const auto edge0 = _mm_add_ps(_mm_mul_ps(edgeX0, px), _mm_set1_ps(rowEdge0));
+                const auto edge1 = _mm_add_ps(_mm_mul_ps(edgeX1, px), _mm_set1_ps(rowEdge1));
+                const auto edge2 = _mm_add_ps(_mm_mul_ps(edgeX2, px), _mm_set1_ps(rowEdge2));
+                const auto inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(edge0, zero), _mm_cmpge_ps(edge1, zero)), _mm_cmpge_ps(edge2, zero));
+                if (_mm_movemask_ps(inside) == 0) continue;
+
+                const auto depth = _mm_add_ps(_mm_mul_ps(depthX, px), _mm_set1_ps(rowDepth));
+                _mm_storeu_ps(row + x, _mm_max_ps(_mm_loadu_ps(row + x), _mm_and_ps(inside, depth)));
+            }
+#else
+            for (auto x = minX; x <= maxX; x++) {
+                const auto px = static_cast<float>(x);
+                if (triangle.edges[0].x * px + rowEdge0 < 0.0f || 
+                    triangle.edges[1].x * px + rowEdge1 < 0.0f || 
+                    triangle.edges[2].x * px + rowEdge2 < 0.0f) continue;
+
+                row[x] = std::max(row[x], triangle.depth.x * px + rowDepth);
+            }
+#endif
+        }
+    }
+}
+
+bool OcclusionCuller::isOccluded(const AABB& worldBox) const {
+    glm::vec2 screenMin(std::numeric_limits<float>::max());
+    glm::vec2 screenMax(std::numeric_limits<float>::lowest());
+    float nearest = 0.0f;
+
+    for (auto i = 0; i < 8; i++) {
+        const glm::vec3 corner(i & 1 ? worldBox.second.x : worldBox.first.x, i & 2 ? worldBox.second.y : worldBox.first.y, i & 4 ? worldBox.second.z : worldBox.first.z);
+        const auto clip = mViewProj * glm::vec4(corner, 1.0f);
+
+        //NOTE: box reaching behind camera is never occluded
+        if (clip.w < NearW) return false;
+
+        const auto invW = 1.0f / clip.w;
+        const glm::vec2 screen((clip.x * invW * 0.5f + 0.5f) * Width, (0.5f - clip.y * invW * 0.5f) * Height);
+        screenMin = glm::min(screenMin, screen);
+        screenMax = glm::max(screenMax, screen);
+        nearest = std::max(nearest, invW);
+    }
+
+    const auto minX = std::max(0, static_cast<int>(std::floor(screenMin.x))) & ~3;
+    const auto minY = std::max(0, static_cast<int>(std::floor(screenMin.y)));
+    const auto maxX = std::min(Width - 1, static_cast<int>(std::floor(screenMax.x)));
+    const auto maxY = std::min(Height - 1, static_cast<int>(std::floor(screenMax.y)));
+    if (minX > maxX || minY > maxY) return false;
+
+    //NOTE: occluded only if every pixel box covers has occluder nearer than nearest box corner
+    for (auto y = minY; y <= maxY; y++) {
+        const auto* row = &mDepth[y * Width];
+#if defined(CULL_SSE)
+        const auto boxDepth = _mm_set1_ps(nearest);
+        for (auto x = minX; x <= maxX; x += 4) {
+            if (_mm_movemask_ps(_mm_cmple_ps(_mm_loadu_ps(row + x), boxDepth)) != 0) return false;
+        }
+#else
+        for (auto x = minX; x <= maxX; x++) {
+            if (row[x] <= nearest) return false;
+        }
+#endif
+    }
+
+    return true;
+}
\ No newline at end of file
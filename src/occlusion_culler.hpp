@@ -0,0 +1,80 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "bounding_volumes.hpp"
+
+class Mesh;
+
+//NOTE: software occlusion culling, large occluders are rasterized into small
+//inverse depth buffer on CPU, boxes behind them are culled. Depth is conservative,
+//pixel gets farthest depth triangle plane has over it, coverage is sampled at pixel
+//centers so occluder silhouette can grow by half a pixel at most.
+class OcclusionCuller {
+public:
+    static constexpr int Width = 256;
+    static constexpr int Height = 128;
+    static constexpr int TileWidth = 32;
+    static constexpr int TileHeight = 32;
+    static constexpr int TilesX = Width / TileWidth;
+    static constexpr int TilesY = Height / TileHeight;
+    static constexpr int TileCount = TilesX * TilesY;
+    static constexpr size_t MaxOccluders = 32;
+    static constexpr size_t MaxOccluderTriangles = 4096;
+    static constexpr size_t MaxTriangles = 32768;
+    static constexpr float MinOccluderSize = 0.1f;
+
+    ~OcclusionCuller();
+
+    void begin(const glm::mat4& viewProj);
+
+    //NOTE: static opaque meshes only, false when mesh can't occlude or budget is full
+    bool addOccluder(Mesh* mesh);
+    void addOccluderBox(const glm::mat4& world, const AABB& box);
+
+    //NOTE: rasterizes binned triangles, tiles are spread over worker threads
+    void rasterize();
+
+    [[nodiscard]] bool isOccluded(const AABB& worldBox) const;
+
+    //NOTE: static, opaque, not skinned and not too detailed
+    static bool isOccluderCandidate(Mesh* mesh);
+
+    [[nodiscard]] unsigned int getOccluderCount() const { return mOccluderCount; }
+    [[nodiscard]] unsigned int getTriangleCount() const { return static_cast<unsigned int>(mTriangles.size()); }
+private:
+    //NOTE: screen space setup, edges and depth are evaluated at pixel centers
+    struct Triangle {
+        glm::vec3 edges[3];
+        glm::vec3 depth;
+        int minX, minY, maxX, maxY;
+    };
+
+    void addTriangle(const glm::vec4& v0, const glm::vec4& v1, const glm::vec4& v2, bool doubleSided);
+    void setupTriangle(const glm::vec4& v0, const glm::vec4& v1, const glm::vec4& v2, bool doubleSided);
+    void rasterizeTiles();
+    void rasterizeTile(int tile);
+    void workerLoop(uint64_t generation);
+
+    glm::mat4 mViewProj{ 1.0f };
+    std::vector<Triangle> mTriangles;
+    std::array<std::vector<uint32_t>, TileCount> mTileTriangles;
+    std::vector<float> mDepth = std::vector<float>(Width * Height, 0.0f);
+    unsigned int mOccluderCount = 0;
+    std::atomic<int> mNextTile{ 0 };
+
+    struct {
+        std::vector<std::thread> threads;
+        std::mutex mutex;
+        std::condition_variable wakeUp;
+        std::condition_variable done;
+        uint64_t generation = 0;
+        unsigned int active = 0;
+        bool stop = false;
+    } mWorkers;
+};
\ No newline at end of file
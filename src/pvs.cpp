@@ -0,0 +1,76 @@
+#include "pvs.hpp"
+
+#include <bit>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+
+constexpr uint32_t PvsMagic = 0x31535650; // PVS1
+
+void Pvs::reset(size_t sectorCount, size_t meshCount, uint64_t key) {
+    mSectorCount = sectorCount;
+    mMeshCount = meshCount;
+    mSectorWords = (sectorCount + 63) / 64;
+    mMeshWords = (meshCount + 63) / 64;
+    mKey = key;
+    mSectorBits.assign(mSectorCount * mSectorWords, 0);
+    mMeshBits.assign(mSectorCount * mMeshWords, 0);
+    mSamples.assign(mSectorCount, 0);
+}
+
+void Pvs::clear() {
+    reset(0, 0, 0);
+}
+
+size_t Pvs::getVisibleSectorCount(size_t row) const {
+    const auto* bits = &mSectorBits[row * mSectorWords];
+    return std::accumulate(bits, bits + mSectorWords, size_t{ 0 }, [](size_t sum, uint64_t word) { return sum + std::popcount(word); });
+}
+
+size_t Pvs::getVisibleMeshCount(size_t row) const {
+    const auto* bits = &mMeshBits[row * mMeshWords];
+    return std::accumulate(bits, bits + mMeshWords, size_t{ 0 }, [](size_t sum, uint64_t word) { return sum + std::popcount(word); });
+}
+
+bool Pvs::save(const std::string& path) const {
+    std::error_code error;
+    std::filesystem::create_directories(std::filesystem::path(path).parent_path(), error);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) return false;
+
+    const uint64_t header[] = { PvsMagic, Version, mKey, mSectorCount, mMeshCount };
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(mSectorBits.data()), mSectorBits.size() * sizeof(uint64_t));
+    file.write(reinterpret_cast<const char*>(mMeshBits.data()), mMeshBits.size() * sizeof(uint64_t));
+    file.write(reinterpret_cast<const char*>(mSamples.data()), mSamples.size() * sizeof(uint32_t));
+    return file.good();
+}
+
+bool Pvs::load(const std::string& path, uint64_t key) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+
+    uint64_t header[5];
+    if (!file.read(reinterpret_cast<char*>(header), sizeof(header))) return false;
+    if (header[0] != PvsMagic || header[1] != Version || header[2] != key) return false;
+
+    reset(header[3], header[4], key);
+    file.read(reinterpret_cast<char*>(mSectorBits.data()), mSectorBits.size() * sizeof(uint64_t));
+    file.read(reinterpret_cast<char*>(mMeshBits.data()), mMeshBits.size() * sizeof(uint64_t));
+    file.read(reinterpret_cast<char*>(mSamples.data()), mSamples.size() * sizeof(uint32_t));
+    if (!file) {
+        clear();
+        return false;
+    }
+
+    return true;
+}
+
+uint64_t Pvs::hash(uint64_t seed, const void* data, size_t size) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++) {
+        seed = (seed ^ bytes[i]) * 0x100000001b3ull;
+    }
+    return seed;
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//NOTE: potentially visible set of a mission, one row per sector with bits of sectors
+//and static meshes which were seen from sampled points inside of it. Baked once and cached
+//on disk, key is hash of everything bake depends on so changed mission is rebaked.
+//Sampling isn't conservative, rows with too few samples are not used.
+class Pvs {
+public:
+    static constexpr uint32_t Version = 3;
+    static constexpr uint32_t MinRowSamples = 8;
+
+    void reset(size_t sectorCount, size_t meshCount, uint64_t key);
+    void clear();
+
+    [[nodiscard]] bool isBaked() const { return mSectorCount > 0; }
+    [[nodiscard]] size_t getSectorCount() const { return mSectorCount; }
+    [[nodiscard]] size_t getMeshCount() const { return mMeshCount; }
+
+    void markSector(size_t row, size_t sector) { mSectorBits[row * mSectorWords + sector / 64] |= 1ull << (sector % 64); }
+    void markMesh(size_t row, size_t mesh) { mMeshBits[row * mMeshWords + mesh / 64] |= 1ull << (mesh % 64); }
+    void addSample(size_t row) { mSamples[row]++; }
+
+    [[nodiscard]] bool isSectorVisible(size_t row, size_t sector) const { return (mSectorBits[row * mSectorWords + sector / 64] >> (sector % 64)) & 1; }
+    [[nodiscard]] bool isMeshVisible(size_t row, size_t mesh) const { return (mMeshBits[row * mMeshWords + mesh / 64] >> (mesh % 64)) & 1; }
+
+    //NOTE: few points falling into sector don't tell what it sees
+    [[nodiscard]] bool hasRow(size_t row) const { return isBaked() && row < mSectorCount && mSamples[row] >= MinRowSamples; }
+    [[nodiscard]] uint32_t getSampleCount(size_t row) const { return mSamples[row]; }
+
+    [[nodiscard]] size_t getVisibleSectorCount(size_t row) const;
+    [[nodiscard]] size_t getVisibleMeshCount(size_t row) const;
+
+    bool save(const std::string& path) const;
+
+    //NOTE: fails when file is missing, broken or baked with different key
+    bool load(const std::string& path, uint64_t key);
+
+    //NOTE: FNV-1a, used to build cache key
+    static uint64_t hash(uint64_t seed, const void* data, size_t size);
+private:
+    size_t mSectorCount = 0;
+    size_t mMeshCount = 0;
+    size_t mSectorWords = 0;
+    size_t mMeshWords = 0;
+    uint64_t mKey = 0;
+    std::vector<uint64_t> mSectorBits;
+    std::vector<uint64_t> mMeshBits;
+    std::vector<uint32_t> mSamples;
+};
\ No newline at end of file
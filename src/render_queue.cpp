@@ -0,0 +1,345 @@
+#include "render_queue.hpp"
+#include "mesh.hpp"
+#include "material.hpp"
+#include "stats.hpp"
+#include "logger.hpp"
+
+#include <cstring>
+#include <cassert>
+#include <algorithm>
+
+void RenderQueue::clear() {
+    //NOTE: arena memory of previous build was rewound, containers are replaced
+    //by empty ones instead of cleared so no capacity points into it
+    mLastCommandCount = std::max(mLastCommandCount, mCommands.size());
+    mCommands = decltype(mCommands)();
+    mBatches = decltype(mBatches)();
+    mNextInBatch = decltype(mNextInBatch)();
+    mRunStatic = decltype(mRunStatic)();
+    mInstances = decltype(mInstances)();
+    mLights = decltype(mLights)();
+    mBones = decltype(mBones)();
+    mScratch = decltype(mScratch)();
+    mRunBatches = decltype(mRunBatches)();
+    mTextureSets = decltype(mTextureSets)();
+    mStats = {};
+
+    //NOTE: reserve for what was pushed before so arena isn't filled by vector growth
+    mCommands.reserve(mLastCommandCount);
+}
+
+uint64_t RenderQueue::getTextureSetId(const Material* material) {
+    const auto [it, inserted] = mTextureSets.try_emplace(material->getTextureSet(), mTextureSets.size() + 1);
+    return it->second & TextureSetMask;
+}
+
+void RenderQueue::push(Mesh* mesh, FaceGroup* faceGroup, Layer layer, Renderer::RenderPass pass, float depth) {
+    uint64_t key = static_cast<uint64_t>(layer) << LayerShift;
+    key |= static_cast<uint64_t>(pass) << PassShift;
+
+    uint64_t state = static_cast<uint64_t>(!mesh->getBoneMatrices().empty()) << SkinnedShift;
+    if (const auto& material = faceGroup->getMaterial()) {
+        state |= (static_cast<uint64_t>(material->getKind()) & 0x7) << KindShift;
+        state |= static_cast<uint64_t>(material->isDoubleSided()) << DoubleSidedShift;
+        state |= getTextureSetId(material.get());
+    }
+
+    //NOTE: positive float bits keep their order as unsigned int
+    uint32_t depthBits = 0;
+    depth = depth > 0.0f ? depth : 0.0f;
+    std::memcpy(&depthBits, &depth, sizeof(depthBits));
+
+    if (pass == Renderer::RenderPass::ALPHA) {
+        //NOTE: blended draws go back to front, depth is quantized to top 16 float bits
+        //( ~1% of distance ) so radix sort skips the empty low digits
+        const uint64_t quantized = depthBits >> 16;
+        key |= (0xFFFF - quantized) << AlphaDepthShift;
+        key |= state << AlphaStateShift;
+    } else {
+        key |= state << StateShift;
+        key |= depthBits;
+    }
+
+    mCommands.push_back({ key, mesh, faceGroup });
+}
+
+void RenderQueue::sort() {
+    //NOTE: report how many switches scene graph order would need
+    countSwitches(mStats.pipelineSwitchesUnsorted, mStats.bindingSwitchesUnsorted);
+
+    //NOTE: LSD radix sort, 8 bits per pass, passes where all keys share digit are skipped
+    mScratch.resize(mCommands.size());
+    for (uint64_t shift = 0; shift < 64; shift += 8) {
+        size_t counts[256] = {};
+        for (const auto& command : mCommands) {
+            counts[(command.key >> shift) & 0xFF]++;
+        }
+
+        if (counts[(mCommands.empty() ? 0 : mCommands.front().key >> shift) & 0xFF] == mCommands.size()) {
+            continue;
+        }
+
+        size_t offset = 0;
+        for (auto& count : counts) {
+            const auto bucketSize = count;
+            count = offset;
+            offset += bucketSize;
+        }
+
+        for (const auto& command : mCommands) {
+            mScratch[counts[(command.key >> shift) & 0xFF]++] = command;
+        }
+
+        mCommands.swap(mScratch);
+    }
+}
+
+static bool gInstancingEnabled = true;
+static bool gStaticBatchingEnabled = true;
+static unsigned int gTransparentDrawBudget = 512;
+
+void RenderQueue::setInstancingEnabled(bool enabled) { gInstancingEnabled = enabled; }
+bool RenderQueue::isInstancingEnabled() { return gInstancingEnabled; }
+
+void RenderQueue::setStaticBatchingEnabled(bool enabled) { gStaticBatchingEnabled = enabled; }
+bool RenderQueue::isStaticBatchingEnabled() { return gStaticBatchingEnabled; }
+
+void RenderQueue::setTransparentDrawBudget(unsigned int budget) { gTransparentDrawBudget = budget; }
+unsigned int RenderQueue::getTransparentDrawBudget() { return gTransparentDrawBudget; }
+
+bool RenderQueue::canInstance(const Command& command, const Command& batchCommand) const {
+    //NOTE: skinned meshes have own bone palette
+    if (!command.mesh->getBoneMatrices().empty() || !batchCommand.mesh->getBoneMatrices().empty()) {
+        return false;
+    }
+
+    //NOTE: lights are shared by whole draw
+    const auto& lights = command.mesh->getLights();
+    const auto& batchLights = batchCommand.mesh->getLights();
+    return lights.size() == batchLights.size() && 
+        std::memcmp(lights.data(), batchLights.data(), lights.size() * sizeof(Renderer::Light)) == 0;
+}
+
+void RenderQueue::flushStaticRun() {
+    //NOTE: order by batch and index offset, then glue neighbouring ranges
+    std::sort(mRunStatic.begin(), mRunStatic.end(), [this](uint32_t a, uint32_t b) {
+        const auto* first = mCommands[a].faceGroup;
+        const auto* second = mCommands[b].faceGroup;
+        if (first->getStaticBatch() != second->getStaticBatch()) {
+            return first->getStaticBatch() < second->getStaticBatch();
+        }
+        return first->getOffset() < second->getOffset();
+    });
+
+    std::optional<size_t> openBatch;
+    for (auto i : mRunStatic) {
+        const auto& command = mCommands[i];
+        mStats.staticBatchMembers++;
+
+        if (openBatch.has_value()) {
+            auto& batch = mBatches[openBatch.value()];
+            const auto& batchCommand = mCommands[batch.firstCommand];
+            if (batchCommand.faceGroup->getStaticBatch() == command.faceGroup->getStaticBatch() &&
+                batch.indexOffset + batch.indexCount == command.faceGroup->getOffset() &&
+                canInstance(command, batchCommand)) {
+                batch.indexCount += command.faceGroup->getIndicesCount();
+                continue;
+            }
+        }
+
+        openBatch = mBatches.size();
+        mBatches.push_back({ i, i, 1, command.faceGroup->getOffset(), command.faceGroup->getIndicesCount(), nullptr, 0, 0, 0 });
+        mStats.staticBatchDraws++;
+    }
+
+    mRunStatic.clear();
+}
+
+void RenderQueue::buildBatches() {
+    mBatches.clear();
+    mBatches.reserve(mCommands.size());
+    mRunStatic.reserve(mCommands.size());
+    mNextInBatch.assign(mCommands.size(), UINT32_MAX);
+    mRunBatches.clear();
+    mRunStatic.clear();
+    mStats.staticBatchDraws = 0;
+    mStats.staticBatchMembers = 0;
+
+    //NOTE: instances of same model don't have to be neighbours after sort ( depth is lowest key part ),
+    //so within run of same layer, pass, pipeline and textures they are looked up by face group
+    uint64_t runBits = UINT64_MAX;
+    for (uint32_t i = 0; i < mCommands.size(); i++) {
+        const auto& command = mCommands[i];
+        const auto bits = getRunBits(command.key);
+        if (bits != runBits) {
+            flushStaticRun();
+            mRunBatches.clear();
+            runBits = bits;
+        }
+
+        //NOTE: baked static geometry, merged at end of run
+        if (gStaticBatchingEnabled && command.faceGroup->getStaticBatch() != 0 && command.mesh->isBakedInPlace()) {
+            mRunStatic.push_back(i);
+            continue;
+        }
+
+        if (gInstancingEnabled) {
+            const InstanceKey instanceKey { 
+                command.faceGroup->getMaterial().get(), 
+                command.faceGroup->getOffset(), 
+                command.faceGroup->getIndicesCount() 
+            };
+
+            const auto it = mRunBatches.find(instanceKey);
+            if (it != mRunBatches.end()) {
+                auto& batch = mBatches[it->second];
+                if (canInstance(command, mCommands[batch.firstCommand])) {
+                    mNextInBatch[batch.lastCommand] = i;
+                    batch.lastCommand = i;
+                    batch.instanceCount++;
+                    continue;
+                }
+            }
+
+            mRunBatches[instanceKey] = mBatches.size();
+        }
+
+        mBatches.push_back({ i, i, 1, command.faceGroup->getOffset(), command.faceGroup->getIndicesCount(), nullptr, 0, 0, 0 });
+    }
+
+    flushStaticRun();
+}
+
+void RenderQueue::snapshotState() {
+    mInstances.clear();
+    mLights.clear();
+    mBones.clear();
+    mInstances.reserve(mCommands.size());
+
+    //NOTE: lay out model matrices so every batch has contiguous range,
+    //light sets and palettes are copied once per mesh run
+    const Mesh* lastMesh = nullptr;
+    for (size_t batchIdx = 0; batchIdx < mBatches.size(); batchIdx++) {
+        auto& batch = mBatches[batchIdx];
+        for (auto i = batch.firstCommand; i != UINT32_MAX; i = mNextInBatch[i]) {
+            mInstances.push_back(mCommands[i].mesh->getDrawMatrix());
+        }
+
+        const auto& command = mCommands[batch.firstCommand];
+        batch.material = command.faceGroup->getMaterial().get();
+
+        if (command.mesh != lastMesh) {
+            const auto& lights = command.mesh->getLights();
+            const auto& bones = command.mesh->getBoneMatrices();
+            assert(lights.size() == Renderer::MaxLights);
+
+            batch.lightsOffset = mLights.size();
+            batch.bonesOffset = mBones.size();
+            batch.bonesCount = bones.size();
+            mLights.insert(mLights.end(), lights.begin(), lights.end());
+            mBones.insert(mBones.end(), bones.begin(), bones.end());
+            lastMesh = command.mesh;
+        } else {
+            const auto& previous = mBatches[batchIdx - 1];
+            batch.lightsOffset = previous.lightsOffset;
+            batch.bonesOffset = previous.bonesOffset;
+            batch.bonesCount = previous.bonesCount;
+        }
+    }
+}
+
+void RenderQueue::build() {
+    buildBatches();
+    snapshotState();
+
+    //NOTE: maps are emptied while their arena is still valid, 
+    //replacing them in clear() then doesn't walk rewound nodes
+    mRunBatches.clear();
+    mTextureSets.clear();
+}
+
+void RenderQueue::submit(const std::function<void(Layer)>& beginLayer) {
+    gStats.pipelineSwitchesUnsorted += mStats.pipelineSwitchesUnsorted;
+    gStats.bindingSwitchesUnsorted += mStats.bindingSwitchesUnsorted;
+    gStats.staticBatchDraws += mStats.staticBatchDraws;
+    gStats.staticBatchMembers += mStats.staticBatchMembers;
+    if (mInstances.empty()) return;
+
+    const auto firstInstance = Renderer::appendInstances(mInstances.data(), static_cast<int>(mInstances.size()));
+    if (firstInstance < 0) {
+        Logger::get().warn("render queue: instance buffer full, {} instances dropped", mInstances.size());
+        return;
+    }
+
+    //NOTE: only data owned by queue is touched here, scene is being culled for next frame meanwhile
+    std::optional<Layer> lastLayer;
+    std::optional<uint64_t> lastPipelineBits;
+    std::optional<size_t> lastLightsOffset;
+    std::optional<size_t> lastBonesOffset;
+    Material* lastMaterial = nullptr;
+    int instance = firstInstance;
+
+    for (const auto& batch : mBatches) {
+        const auto key = mCommands[batch.firstCommand].key;
+        const bool isTransparent = getPass(key) == Renderer::RenderPass::ALPHA;
+        const auto layer = getLayer(key);
+        if (layer != lastLayer) {
+            beginLayer(layer);
+            lastLayer = layer;
+        }
+
+        if (batch.lightsOffset != lastLightsOffset) {
+            Renderer::setLights(mLights.data() + batch.lightsOffset, Renderer::MaxLights);
+            lastLightsOffset = batch.lightsOffset;
+        }
+
+        if (batch.bonesOffset != lastBonesOffset) {
+            Renderer::setBones(mBones.data() + batch.bonesOffset, batch.bonesCount);
+            lastBonesOffset = batch.bonesOffset;
+        }
+
+        if (batch.material != lastMaterial) {
+            if (batch.material != nullptr) {
+                batch.material->bind();
+            }
+            lastMaterial = batch.material;
+        }
+
+        const auto pipelineBits = getPipelineBits(key);
+        if (pipelineBits != lastPipelineBits) {
+            Renderer::applyPipeline();
+            lastPipelineBits = pipelineBits;
+        }
+
+        //NOTE: instance range moves every draw, renderer drops bindings that didn't change
+        Renderer::setFirstInstance(instance);
+        Renderer::applyBindings();
+        Renderer::applyUniforms();
+        Renderer::draw(
+            static_cast<int>(batch.indexOffset), 
+            static_cast<int>(batch.indexCount), 
+            static_cast<int>(batch.instanceCount)
+        );
+
+        instance += static_cast<int>(batch.instanceCount);
+        gStats.transparentDraws += isTransparent;
+    }
+}
+
+void RenderQueue::countSwitches(unsigned int& pipelineSwitches, unsigned int& bindingSwitches) const {
+    pipelineSwitches = 0;
+    bindingSwitches = 0;
+
+    std::optional<uint64_t> lastPipelineBits;
+    std::optional<uint64_t> lastTextureSet;
+    for (const auto& command : mCommands) {
+        const auto pipelineBits = getPipelineBits(command.key);
+        const auto textureSet = getTextureSet(command.key);
+        const bool pipelineChanged = pipelineBits != lastPipelineBits;
+
+        pipelineSwitches += pipelineChanged;
+        bindingSwitches += pipelineChanged || textureSet != lastTextureSet;
+        lastPipelineBits = pipelineBits;
+        lastTextureSet = textureSet;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,157 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <functional>
+#include <array>
+#include <unordered_map>
+
+#include "renderer.hpp"
+#include "frame_arena.hpp"
+
+class Mesh;
+class FaceGroup;
+class Material;
+
+//NOTE: every face group drawn in frame is one command, commands are sorted by key
+//so draws sharing pipeline and textures end up next to each other
+//NOTE: queue is filled, sorted and built on cull thread, after build it owns everything
+//submit needs ( matrices, light sets, bone palettes ) and scene can change under it
+//key layout from most significant bit:
+//  normal pass: layer (1) | pass (1) | state (30) | depth (32), front to back within same state
+//  alpha pass:  layer (1) | pass (1) | inverted depth (16) | state (30) | unused (16), back to front
+//state: material kind (3) | skinned (1) | double sided (1) | texture set (25)
+class RenderQueue {
+public:
+    enum class Layer : uint64_t {
+        BACKDROP,
+        WORLD
+    };
+
+    struct Command {
+        uint64_t key;
+        Mesh* mesh;
+        FaceGroup* faceGroup;
+    };
+
+    void clear();
+    void push(Mesh* mesh, FaceGroup* faceGroup, Layer layer, Renderer::RenderPass pass, float depth);
+    void sort();
+
+    //NOTE: commands drawing same face group with same state and lights are merged into one instanced draw
+    void build();
+
+    //NOTE: beginLayer is called whenever layer changes so caller can set projection etc.
+    void submit(const std::function<void(Layer)>& beginLayer);
+
+    static void setInstancingEnabled(bool enabled);
+    static bool isInstancingEnabled();
+
+    //NOTE: visible face groups of one static batch with neighbouring index ranges are drawn at once
+    static void setStaticBatchingEnabled(bool enabled);
+    static bool isStaticBatchingEnabled();
+
+    [[nodiscard]] const FrameVector<Command>& getCommands() const { return mCommands; }
+    [[nodiscard]] bool isEmpty() const { return mCommands.empty(); }
+
+    static constexpr uint64_t LayerShift       = 63;
+    static constexpr uint64_t PassShift        = 62;
+    static constexpr uint64_t StateShift       = 32;
+    static constexpr uint64_t AlphaDepthShift  = 46;
+    static constexpr uint64_t AlphaStateShift  = 16;
+
+    //NOTE: relative to start of state bits
+    static constexpr uint64_t KindShift        = 27;
+    static constexpr uint64_t SkinnedShift     = 26;
+    static constexpr uint64_t DoubleSidedShift = 25;
+    static constexpr uint64_t TextureSetMask   = (1ull << 25) - 1;
+
+    static Renderer::RenderPass getPass(uint64_t key) { return static_cast<Renderer::RenderPass>((key >> PassShift) & 0x1); }
+    static uint64_t getStateShift(uint64_t key) { return getPass(key) == Renderer::RenderPass::ALPHA ? AlphaStateShift : StateShift; }
+
+    //NOTE: bits selecting pipeline ( shader variant, pass, culling ), draws with same bits share pipeline
+    static uint64_t getPipelineBits(uint64_t key) { 
+        return ((key >> (getStateShift(key) + DoubleSidedShift)) & 0x1F) | (static_cast<uint64_t>(getPass(key)) << 5); 
+    }
+
+    static uint64_t getTextureSet(uint64_t key) { return (key >> getStateShift(key)) & TextureSetMask; }
+    static Layer getLayer(uint64_t key) { return static_cast<Layer>(key >> LayerShift); }
+
+    //NOTE: everything above texture set, draws are merged only inside run of equal bits
+    static uint64_t getRunBits(uint64_t key) { return key >> getStateShift(key); }
+
+    //NOTE: transparent draws per frame above budget are only reported, every one is drawn
+    static void setTransparentDrawBudget(unsigned int budget);
+    static unsigned int getTransparentDrawBudget();
+private:
+    //NOTE: commands of one draw are chained through mNextInBatch,
+    //merged static ranges have single instance and only grow index range
+    struct Batch {
+        uint32_t firstCommand;
+        uint32_t lastCommand;
+        uint32_t instanceCount;
+        size_t indexOffset;
+        size_t indexCount;
+
+        //NOTE: filled by build, snapshot of state for submit
+        Material* material;
+        size_t lightsOffset;
+        size_t bonesOffset;
+        size_t bonesCount;
+    };
+
+    //NOTE: counted during build, published to gStats on submit
+    struct BuildStats {
+        unsigned int pipelineSwitchesUnsorted;
+        unsigned int bindingSwitchesUnsorted;
+        unsigned int staticBatchDraws;
+        unsigned int staticBatchMembers;
+    };
+
+    //NOTE: same material on same index range, within run of equal state bits
+    struct InstanceKey {
+        const Material* material;
+        size_t offset;
+        size_t count;
+        bool operator==(const InstanceKey& other) const {
+            return material == other.material && offset == other.offset && count == other.count;
+        }
+    };
+
+    struct InstanceKeyHasher {
+        size_t operator()(const InstanceKey& key) const {
+            return std::hash<const void*>()(key.material) ^ (key.offset * 31 + key.count);
+        }
+    };
+
+    struct TextureSetHasher {
+        size_t operator()(const std::array<uint32_t, 4>& set) const {
+            size_t hash = 0;
+            for (auto id : set) hash = hash * 31 + id;
+            return hash;
+        }
+    };
+
+    //NOTE: dense per frame ids, equal id means exactly same textures bound, 0 is no material
+    uint64_t getTextureSetId(const Material* material);
+    void countSwitches(unsigned int& pipelineSwitches, unsigned int& bindingSwitches) const;
+    void buildBatches();
+    void snapshotState();
+    void flushStaticRun();
+    bool canInstance(const Command& command, const Command& batchCommand) const;
+
+    //NOTE: everything below lives in frame arena, see clear()
+    FrameVector<Command> mCommands;
+    FrameVector<Batch> mBatches;
+    FrameVector<uint32_t> mNextInBatch;
+    FrameVector<uint32_t> mRunStatic;
+    FrameVector<glm::mat4> mInstances;
+    FrameVector<Renderer::Light> mLights;
+    FrameVector<glm::mat4> mBones;
+    FrameVector<Command> mScratch;
+    std::unordered_map<InstanceKey, size_t, InstanceKeyHasher, std::equal_to<InstanceKey>, 
+        FrameAllocator<std::pair<const InstanceKey, size_t>>> mRunBatches;
+    std::unordered_map<std::array<uint32_t, 4>, uint64_t, TextureSetHasher, std::equal_to<std::array<uint32_t, 4>>,
+        FrameAllocator<std::pair<const std::array<uint32_t, 4>, uint64_t>>> mTextureSets;
+    size_t mLastCommandCount = 0;
+    BuildStats mStats{};
+};
\ No newline at end of file
@@ -22,8 +22,11 @@
 #include <glm/gtx/transform.hpp>
 
 #include "shader_universal.h"
+#include "shader_oit.h"
 #include "renderer.hpp"
 #include "gui.hpp"
+#include "stats.hpp"
+#include "frame_arena.hpp"
 
 /* debug rendering */
 struct Sphere {
@@ -41,14 +44,16 @@ static struct {
         sg_pass_action passAction;
     } display;
 
-    //NOTE: we have array of 2 piplines
-    //for backface culling and double sided materials
+    //NOTE: pipeline for every shader variant, pass and culling mode
+    //indexed by Renderer::getPipelineIndex
     struct {
-        sg_shader shader;
-        sg_pipeline pip[2];
+        sg_shader shaders[static_cast<int>(Renderer::ShaderVariant::COUNT)];
+        sg_shader oitShaders[static_cast<int>(Renderer::ShaderVariant::COUNT)];
+        sg_pipeline pipelines[Renderer::PipelineCount];
 
-        //sg_shader alphablendShader;
-        sg_pipeline alphaPip[2];
+        //NOTE: model matrices of all draws in frame, appended per draw
+        sg_buffer instanceBuffer;
+        int instanceBytesUsed;
 
         sg_shader debugShader;
         sg_pipeline debugPip;
@@ -60,20 +65,126 @@ static struct {
         sg_image colorImg;
     }  offscreen;
 
+    //NOTE: depth of capture pass lives only while capturing
+    struct {
+        sg_pass pass;
+        sg_image depthImg;
+    } capture;
+
+    //NOTE: weighted blended OIT targets share depth with offscreen pass
+    struct {
+        sg_image accumImg;
+        sg_image revealImg;
+        sg_pass pass;
+        sg_pass_action passAction;
+        sg_pass_action resumeAction;
+        sg_shader compositeShader;
+        sg_pipeline compositePip;
+        sg_buffer triangleBuffer;
+    } oit;
+
+    Renderer::TransparencyMode transparencyMode;
+
     sg_image emptyTexture;
 
     bool isRelative;
-    glm::mat4 model;
     glm::mat4 view;
     glm::mat4 proj;
     glm::vec3 viewPos;
+    glm::vec3 fogColor;
+    glm::vec2 fogRange;
 
     Renderer::Material material;
     Renderer::RenderPass pass;
-    std::vector<Renderer::Light> lights;
-    std::vector<glm::mat4> bones; 
+    //NOTE: views into caller data ( render queue ), valid until draw
+    const Renderer::Light* lights;
+    size_t lightsCount;
+    const glm::mat4* bones;
+    size_t bonesCount;
+
+    //NOTE: blocks touched by setters since last applyUniforms
+    struct {
+        bool vsFrame;
+        bool vsObject;
+        bool vsLights;
+        bool vsBones;
+        bool fsMaterial;
+    } dirty;
+
+    //NOTE: last state handed to sokol, used to drop redundant applies
+    //invalidated at start of every pass
+    struct {
+        sg_pipeline pipeline;
+        sg_shader shader;
+        Renderer::ShaderVariant variant;
+        sg_bindings bindings;
+        universal_vs_frame_t vsFrame;
+        universal_vs_object_t vsObject;
+        universal_vs_lights_t vsLights;
+        universal_vs_bones_t vsBones;
+        universal_fs_material_t fsMaterial;
+        bool bindingsValid;
+        bool uniformsValid[SG_NUM_SHADER_STAGES][SG_MAX_SHADERSTAGE_UBS];
+    } applied;
 } state;
 
+//NOTE: every material kind on every mesh type has to land on existing pipeline
+static constexpr bool isPipelineMappingValid() {
+    constexpr Renderer::MaterialKind kinds[] = {
+        Renderer::MaterialKind::DIFFUSE,
+        Renderer::MaterialKind::CUTOUT,
+        Renderer::MaterialKind::ALPHA,
+        Renderer::MaterialKind::ENV,
+        Renderer::MaterialKind::BILLBOARD
+    };
+
+    bool used[Renderer::PipelineCount] = {};
+    for (auto kind : kinds) {
+        for (int skinned = 0; skinned < 2; skinned++) {
+            for (auto pass : { Renderer::RenderPass::NORMAL, Renderer::RenderPass::ALPHA, Renderer::RenderPass::WEIGHTED }) {
+                for (int doubleSided = 0; doubleSided < 2; doubleSided++) {
+                    const auto variant = Renderer::getShaderVariant(kind, skinned);
+                    const auto index = Renderer::getPipelineIndex(variant, pass, doubleSided);
+                    if (index < 0 || index >= Renderer::PipelineCount) return false;
+                    used[index] = true;
+                }
+            }
+        }
+    }
+
+    //NOTE: and no pipeline is created for nothing
+    for (auto isUsed : used) {
+        if (!isUsed) return false;
+    }
+    return true;
+}
+
+static_assert(isPipelineMappingValid(), "material kinds don't map onto pipeline table");
+
+static void invalidateAppliedState() {
+    state.applied.pipeline = { SG_INVALID_ID };
+    state.applied.shader = { SG_INVALID_ID };
+    state.applied.variant = Renderer::ShaderVariant::COUNT;
+    state.applied.bindingsValid = false;
+    memset(state.applied.uniformsValid, 0, sizeof(state.applied.uniformsValid));
+    state.dirty = { true, true, true, true, true };
+}
+
+template<typename T>
+static void applyUniformBlock(sg_shader_stage stage, int slot, const T& block, T& applied) {
+    auto& valid = state.applied.uniformsValid[stage][slot];
+    if (valid && memcmp(&block, &applied, sizeof(T)) == 0) {
+        gStats.uniformUploadsSkipped++;
+        return;
+    }
+
+    applied = block;
+    valid = true;
+    sg_range range{ &block, sizeof(T) };
+    sg_apply_uniforms(stage, slot, &range);
+    gStats.uniformUploads++;
+}
+
 void Renderer::createRenderTarget(int width, int height) {
     
     /* destroy previous resource (can be called for invalid id) */
@@ -105,6 +216,30 @@ void Renderer::createRenderTarget(int width, int height) {
     state.offscreen.passDesc.depth_stencil_attachment.image = depthImg;
     state.offscreen.passDesc.label = "offscreen-pass";
     state.offscreen.pass = sg_make_pass(&state.offscreen.passDesc);
+
+    //NOTE: OIT accumulation ( premultiplied color, weight ) and revealage
+    sg_destroy_pass(state.oit.pass);
+    sg_destroy_image(state.oit.accumImg);
+    sg_destroy_image(state.oit.revealImg);
+
+    sg_image_desc accumImgDesc      = colorImgDesc;
+    accumImgDesc.pixel_format       = SG_PIXELFORMAT_RGBA16F;
+    accumImgDesc.min_filter         = SG_FILTER_NEAREST;
+    accumImgDesc.mag_filter         = SG_FILTER_NEAREST;
+    accumImgDesc.label              = "oit-accum-image";
+    state.oit.accumImg              = sg_make_image(&accumImgDesc);
+
+    sg_image_desc revealImgDesc     = accumImgDesc;
+    revealImgDesc.pixel_format      = SG_PIXELFORMAT_R16F;
+    revealImgDesc.label             = "oit-reveal-image";
+    state.oit.revealImg             = sg_make_image(&revealImgDesc);
+
+    sg_pass_desc oitPassDesc = {};
+    oitPassDesc.color_attachments[0].image = state.oit.accumImg;
+    oitPassDesc.color_attachments[1].image = state.oit.revealImg;
+    oitPassDesc.depth_stencil_attachment.image = depthImg;
+    oitPassDesc.label = "oit-pass";
+    state.oit.pass = sg_make_pass(&oitPassDesc);
 }
 
 void Renderer::init() {
@@ -131,6 +266,19 @@ void Renderer::init() {
     sg_color_attachment_action& colorOffscreen = state.offscreen.passAction.colors[0];
     colorOffscreen.action = SG_ACTION_CLEAR;
     colorOffscreen.value = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+    /* OIT pass clears accumulation to zero and revealage to one, keeps opaque depth */
+    state.oit.passAction.colors[0].action = SG_ACTION_CLEAR;
+    state.oit.passAction.colors[0].value = { 0.0f, 0.0f, 0.0f, 0.0f };
+    state.oit.passAction.colors[1].action = SG_ACTION_CLEAR;
+    state.oit.passAction.colors[1].value = { 1.0f, 1.0f, 1.0f, 1.0f };
+    state.oit.passAction.depth.action = SG_ACTION_LOAD;
+    state.oit.passAction.stencil.action = SG_ACTION_LOAD;
+
+    /* offscreen pass continues after OIT with what was drawn */
+    state.oit.resumeAction.colors[0].action = SG_ACTION_LOAD;
+    state.oit.resumeAction.depth.action = SG_ACTION_LOAD;
+    state.oit.resumeAction.stencil.action = SG_ACTION_LOAD;
     
     /* init gui */
     simgui_desc_t simgui_desc = { };
@@ -160,88 +308,210 @@ void Renderer::init() {
     depthState.write_enabled = true;
     depthState.pixel_format = SG_PIXELFORMAT_DEPTH_STENCIL;
 
-    /* create layout for ofscreen pipelines */
-    sg_layout_desc layoutDesc{};
-    layoutDesc.attrs[ATTR_universal_vs_aPos].format         = SG_VERTEXFORMAT_FLOAT3;
-    layoutDesc.attrs[ATTR_universal_vs_aNormal].format      = SG_VERTEXFORMAT_FLOAT3;
-    layoutDesc.attrs[ATTR_universal_vs_aTexCoord].format    = SG_VERTEXFORMAT_FLOAT2;
-    layoutDesc.attrs[ATTR_universal_vs_aIndexes].format     = SG_VERTEXFORMAT_FLOAT2;
-    layoutDesc.attrs[ATTR_universal_vs_aWeights].format     = SG_VERTEXFORMAT_FLOAT2;
+    /* create instance buffer, model matrix per instance */
+    sg_buffer_desc instanceBufferDesc{};
+    instanceBufferDesc.size     = sizeof(glm::mat4) * MaxInstances;
+    instanceBufferDesc.usage    = SG_USAGE_STREAM;
+    instanceBufferDesc.label    = "instance-buffer";
+    state.offscreen.instanceBuffer = sg_make_buffer(&instanceBufferDesc);
+    assert(state.offscreen.instanceBuffer.id != SG_INVALID_ID);
+
+    //NOTE: mat4 is passed as 4 vec4 columns from second buffer
+    auto setInstanceAttrs = [](sg_layout_desc& layoutDesc, int firstAttr) {
+        layoutDesc.buffers[1].stride    = sizeof(glm::mat4);
+        layoutDesc.buffers[1].step_func = SG_VERTEXSTEP_PER_INSTANCE;
+        for (int i = 0; i < 4; i++) {
+            layoutDesc.attrs[firstAttr + i].buffer_index    = 1;
+            layoutDesc.attrs[firstAttr + i].offset          = static_cast<int>(sizeof(glm::vec4)) * i;
+            layoutDesc.attrs[firstAttr + i].format          = SG_VERTEXFORMAT_FLOAT4;
+        }
+    };
 
-    constexpr int OFFSCREEN_SAMPLE_COUNT = 4;
+    /* create layouts for ofscreen pipelines, static variants skip bone attributes */
+    sg_layout_desc staticLayoutDesc{};
+    staticLayoutDesc.buffers[0].stride                                  = sizeof(Vertex);
+    staticLayoutDesc.attrs[ATTR_universal_vs_static_aPos].format        = SG_VERTEXFORMAT_FLOAT3;
+    staticLayoutDesc.attrs[ATTR_universal_vs_static_aNormal].format     = SG_VERTEXFORMAT_FLOAT3;
+    staticLayoutDesc.attrs[ATTR_universal_vs_static_aTexCoord].format   = SG_VERTEXFORMAT_FLOAT2;
+    setInstanceAttrs(staticLayoutDesc, ATTR_universal_vs_static_aModel0);
+
+    sg_layout_desc skinnedLayoutDesc{};
+    skinnedLayoutDesc.buffers[0].stride                                 = sizeof(Vertex);
+    skinnedLayoutDesc.attrs[ATTR_universal_vs_skinned_aPos].format      = SG_VERTEXFORMAT_FLOAT3;
+    skinnedLayoutDesc.attrs[ATTR_universal_vs_skinned_aNormal].format   = SG_VERTEXFORMAT_FLOAT3;
+    skinnedLayoutDesc.attrs[ATTR_universal_vs_skinned_aTexCoord].format = SG_VERTEXFORMAT_FLOAT2;
+    skinnedLayoutDesc.attrs[ATTR_universal_vs_skinned_aIndexes].format  = SG_VERTEXFORMAT_FLOAT2;
+    skinnedLayoutDesc.attrs[ATTR_universal_vs_skinned_aWeights].format  = SG_VERTEXFORMAT_FLOAT2;
+    setInstanceAttrs(skinnedLayoutDesc, ATTR_universal_vs_skinned_aModel0);
+
+    static_assert(ATTR_universal_vs_billboard_aModel0 == ATTR_universal_vs_static_aModel0, "billboard shares static layout");
 
-    //NOTE: universal shader
-    {
-        state.offscreen.shader          = sg_make_shader(universal_universal_shader_desc(sg_query_backend()));
+    constexpr int OFFSCREEN_SAMPLE_COUNT = 4;
 
-        //NOTE: default pipeline
-        {
-            sg_pipeline_desc pipelineDesc   = {};
-            pipelineDesc.colors[0].pixel_format = SG_PIXELFORMAT_RGBA8;
-            pipelineDesc.sample_count       = OFFSCREEN_SAMPLE_COUNT;
-            pipelineDesc.shader             = state.offscreen.shader;
-            pipelineDesc.layout             = layoutDesc;
-            pipelineDesc.depth              = depthState;
-            pipelineDesc.index_type         = sg_index_type::SG_INDEXTYPE_UINT32;
+    //NOTE: universal shader variants
+    struct {
+        ShaderVariant variant;
+        const sg_shader_desc* desc;
+        const sg_shader_desc* oitDesc;
+        const sg_layout_desc* layout;
+        const char* label;
+    } variants[] = {
+        { ShaderVariant::STATIC,      universal_static_shader_desc(sg_query_backend()),      universal_static_oit_shader_desc(sg_query_backend()),      &staticLayoutDesc,  "static" },
+        { ShaderVariant::STATIC_ENV,  universal_static_env_shader_desc(sg_query_backend()),  universal_static_env_oit_shader_desc(sg_query_backend()),  &staticLayoutDesc,  "static-env" },
+        { ShaderVariant::SKINNED,     universal_skinned_shader_desc(sg_query_backend()),     universal_skinned_oit_shader_desc(sg_query_backend()),     &skinnedLayoutDesc, "skinned" },
+        { ShaderVariant::SKINNED_ENV, universal_skinned_env_shader_desc(sg_query_backend()), universal_skinned_env_oit_shader_desc(sg_query_backend()), &skinnedLayoutDesc, "skinned-env" },
+        { ShaderVariant::BILLBOARD,   universal_billboard_shader_desc(sg_query_backend()),   universal_billboard_oit_shader_desc(sg_query_backend()),   &staticLayoutDesc,  "billboard" },
+    };
 
-            pipelineDesc.cull_mode          = sg_cull_mode::SG_CULLMODE_NONE;
-            pipelineDesc.label              = "universal-pipeline";
-            state.offscreen.pip[0]          = sg_make_pipeline(&pipelineDesc);
+    for (const auto& variant : variants) {
+        const auto shader = sg_make_shader(variant.desc);
+        assert(shader.id != SG_INVALID_ID);
+        state.offscreen.shaders[static_cast<int>(variant.variant)] = shader;
 
-            pipelineDesc.cull_mode          = sg_cull_mode::SG_CULLMODE_BACK;
-            pipelineDesc.label              = "universal-pipeline-backfaceculled";
-            state.offscreen.pip[1]          = sg_make_pipeline(&pipelineDesc);
-        }
+        const auto oitShader = sg_make_shader(variant.oitDesc);
+        assert(oitShader.id != SG_INVALID_ID);
+        state.offscreen.oitShaders[static_cast<int>(variant.variant)] = oitShader;
 
-        //NOTE: alpha blending pipeline
-        {
+        for (auto pass : { RenderPass::NORMAL, RenderPass::ALPHA, RenderPass::WEIGHTED }) {
             sg_pipeline_desc pipelineDesc   = {};
             sg_color_state& colorState      = pipelineDesc.colors[0];
             colorState.pixel_format         = SG_PIXELFORMAT_RGBA8;
-            colorState.blend.enabled            = true;
-            colorState.blend.src_factor_rgb     = SG_BLENDFACTOR_SRC_ALPHA;
-            colorState.blend.src_factor_rgb     = SG_BLENDFACTOR_SRC_ALPHA;
-            colorState.blend.dst_factor_rgb     = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
-            colorState.blend.op_rgb             = SG_BLENDOP_ADD;
-            colorState.blend.src_factor_alpha   = SG_BLENDFACTOR_SRC_ALPHA;
-            colorState.blend.dst_factor_alpha   = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
-            colorState.blend.op_alpha           = SG_BLENDOP_ADD;
+
+            //NOTE: alpha blending pipeline
+            if (pass == RenderPass::ALPHA) {
+                colorState.blend.enabled            = true;
+                colorState.blend.src_factor_rgb     = SG_BLENDFACTOR_SRC_ALPHA;
+                colorState.blend.dst_factor_rgb     = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+                colorState.blend.op_rgb             = SG_BLENDOP_ADD;
+                colorState.blend.src_factor_alpha   = SG_BLENDFACTOR_SRC_ALPHA;
+                colorState.blend.dst_factor_alpha   = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+                colorState.blend.op_alpha           = SG_BLENDOP_ADD;
+            }
+
+            //NOTE: OIT pipeline, accumulation is summed, revealage is multiplied by ( 1 - alpha )
+            if (pass == RenderPass::WEIGHTED) {
+                pipelineDesc.color_count            = 2;
+                colorState.pixel_format             = SG_PIXELFORMAT_RGBA16F;
+                colorState.blend.enabled            = true;
+                colorState.blend.src_factor_rgb     = SG_BLENDFACTOR_ONE;
+                colorState.blend.dst_factor_rgb     = SG_BLENDFACTOR_ONE;
+                colorState.blend.src_factor_alpha   = SG_BLENDFACTOR_ONE;
+                colorState.blend.dst_factor_alpha   = SG_BLENDFACTOR_ONE;
+
+                sg_color_state& revealState         = pipelineDesc.colors[1];
+                revealState.pixel_format            = SG_PIXELFORMAT_R16F;
+                revealState.blend.enabled           = true;
+                revealState.blend.src_factor_rgb    = SG_BLENDFACTOR_ZERO;
+                revealState.blend.dst_factor_rgb    = SG_BLENDFACTOR_ONE_MINUS_SRC_COLOR;
+                revealState.blend.src_factor_alpha  = SG_BLENDFACTOR_ZERO;
+                revealState.blend.dst_factor_alpha  = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+            }
 
             pipelineDesc.sample_count       = OFFSCREEN_SAMPLE_COUNT;
-            pipelineDesc.shader             = state.offscreen.shader;
-            pipelineDesc.layout             = layoutDesc;
+            pipelineDesc.shader             = pass == RenderPass::WEIGHTED ? oitShader : shader;
+            pipelineDesc.layout             = *variant.layout;
             pipelineDesc.depth              = depthState;
             pipelineDesc.index_type         = sg_index_type::SG_INDEXTYPE_UINT32;
+            pipelineDesc.label              = variant.label;
 
-            pipelineDesc.cull_mode          = sg_cull_mode::SG_CULLMODE_NONE;
-            pipelineDesc.label              = "universal-pipeline-alphablend";
-            state.offscreen.alphaPip[0]     = sg_make_pipeline(&pipelineDesc);
+            //NOTE: blended surfaces are tested against opaques but don't hide each other
+            if (pass != RenderPass::NORMAL) {
+                pipelineDesc.depth.write_enabled = false;
+            }
 
-            pipelineDesc.cull_mode          = sg_cull_mode::SG_CULLMODE_BACK;
-            pipelineDesc.label              = "universal-pipeline-alphablend-backfaceculled";
-            state.offscreen.alphaPip[1]     = sg_make_pipeline(&pipelineDesc);
+            for (bool doubleSided : { true, false }) {
+                pipelineDesc.cull_mode = doubleSided ? sg_cull_mode::SG_CULLMODE_NONE : sg_cull_mode::SG_CULLMODE_BACK;
+                const auto pipeline = sg_make_pipeline(&pipelineDesc);
+                assert(pipeline.id != SG_INVALID_ID);
+                state.offscreen.pipelines[getPipelineIndex(variant.variant, pass, doubleSided)] = pipeline;
+            }
         }
     }
 
+    /* OIT composite, one triangle covering screen blended over opaque image */
+    {
+        const float triangle[] = { -1.0f, -1.0f, 3.0f, -1.0f, -1.0f, 3.0f };
+        sg_buffer_desc triangleDesc{};
+        triangleDesc.data   = SG_RANGE(triangle);
+        triangleDesc.label  = "oit-triangle";
+        state.oit.triangleBuffer = sg_make_buffer(&triangleDesc);
+
+        state.oit.compositeShader = sg_make_shader(oit_composite_shader_desc(sg_query_backend()));
+        assert(state.oit.compositeShader.id != SG_INVALID_ID);
+
+        sg_pipeline_desc compositeDesc   = {};
+        compositeDesc.shader             = state.oit.compositeShader;
+        compositeDesc.layout.attrs[ATTR_oit_vs_composite_aPos].format = SG_VERTEXFORMAT_FLOAT2;
+        compositeDesc.sample_count       = OFFSCREEN_SAMPLE_COUNT;
+        compositeDesc.depth.pixel_format = SG_PIXELFORMAT_DEPTH_STENCIL;
+        compositeDesc.depth.compare      = SG_COMPAREFUNC_ALWAYS;
+        compositeDesc.depth.write_enabled = false;
+
+        sg_color_state& colorState          = compositeDesc.colors[0];
+        colorState.pixel_format             = SG_PIXELFORMAT_RGBA8;
+        colorState.blend.enabled            = true;
+        colorState.blend.src_factor_rgb     = SG_BLENDFACTOR_SRC_ALPHA;
+        colorState.blend.dst_factor_rgb     = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+        colorState.blend.src_factor_alpha   = SG_BLENDFACTOR_SRC_ALPHA;
+        colorState.blend.dst_factor_alpha   = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+        compositeDesc.label                 = "oit-composite";
+        state.oit.compositePip = sg_make_pipeline(&compositeDesc);
+        assert(state.oit.compositePip.id != SG_INVALID_ID);
+    }
+
     Gui::init();
 }
 
 void Renderer::destroy() {
     sg_destroy_image(state.emptyTexture);
-    sg_destroy_shader(state.offscreen.shader);
+    sg_destroy_buffer(state.offscreen.instanceBuffer);
+    for (auto pipeline : state.offscreen.pipelines) {
+        sg_destroy_pipeline(pipeline);
+    }
+
+    for (auto shader : state.offscreen.shaders) {
+        sg_destroy_shader(shader);
+    }
 
-    for(size_t i = 0; i < 2; i++) {
-        sg_destroy_pipeline(state.offscreen.pip[i]);
-        sg_destroy_pipeline(state.offscreen.alphaPip[i]);
+    for (auto shader : state.offscreen.oitShaders) {
+        sg_destroy_shader(shader);
     }
 
+    sg_destroy_pipeline(state.oit.compositePip);
+    sg_destroy_shader(state.oit.compositeShader);
+    sg_destroy_buffer(state.oit.triangleBuffer);
+    sg_destroy_pass(state.oit.pass);
+    sg_destroy_image(state.oit.accumImg);
+    sg_destroy_image(state.oit.revealImg);
+
     simgui_shutdown();
     sgl_shutdown();
     sg_shutdown();
 }
 
 void Renderer::begin() {
+    //NOTE: allocations made since last frame started, GUI included
+    static uint64_t lastHeapAllocations = 0;
+    const auto heapAllocations = getHeapAllocationCount();
+    gStats.heapAllocations = static_cast<unsigned int>(heapAllocations - lastHeapAllocations);
+    lastHeapAllocations = heapAllocations;
+
+    gStats.drawCalls = 0;
+    gStats.pipelineSwitches = 0;
+    gStats.bindingSwitches = 0;
+    gStats.pipelineSwitchesSkipped = 0;
+    gStats.bindingSwitchesSkipped = 0;
+    gStats.uniformUploads = 0;
+    gStats.uniformUploadsSkipped = 0;
+    gStats.drawCallsUninstanced = 0;
+    gStats.instancedDraws = 0;
+    gStats.staticBatchDraws = 0;
+    gStats.staticBatchMembers = 0;
+    gStats.transparentDraws = 0;
+    gStats.pipelineSwitchesUnsorted = 0;
+    gStats.bindingSwitchesUnsorted = 0;
     sg_begin_pass(state.offscreen.pass, &state.offscreen.passAction);
+    invalidateAppliedState();
 }
 
 void Renderer::setPass(RenderPass pass) {
@@ -251,9 +521,40 @@ void Renderer::setPass(RenderPass pass) {
 
 Renderer::RenderPass Renderer::getPass() { return state.pass; }
 
+void Renderer::setTransparencyMode(TransparencyMode mode) { state.transparencyMode = mode; }
+Renderer::TransparencyMode Renderer::getTransparencyMode() { return state.transparencyMode; }
+
+void Renderer::beginWeightedTransparency() {
+    sg_end_pass();
+    sg_begin_pass(state.oit.pass, &state.oit.passAction);
+    invalidateAppliedState();
+    setPass(RenderPass::WEIGHTED);
+}
+
+void Renderer::endWeightedTransparency() {
+    sg_end_pass();
+    sg_begin_pass(state.offscreen.pass, &state.oit.resumeAction);
+
+    sg_bindings bindings{};
+    bindings.vertex_buffers[0] = state.oit.triangleBuffer;
+    bindings.fs_images[SLOT_oit_accumTexture] = state.oit.accumImg;
+    bindings.fs_images[SLOT_oit_revealTexture] = state.oit.revealImg;
+    sg_apply_pipeline(state.oit.compositePip);
+    sg_apply_bindings(&bindings);
+    sg_draw(0, 3, 1);
+    gStats.drawCalls++;
+
+    //NOTE: sokol state was replaced behind cache back
+    invalidateAppliedState();
+    setPass(RenderPass::NORMAL);
+}
+
 void Renderer::end()  {  sgl_draw(); sg_end_pass(); }
 
 void Renderer::commit() { 
+    //NOTE: cull thread is idle here, list drawn this frame is done with its arena
+    FrameArena::nextFrame();
+
     //NOTE: begin default pass for GUI
     {
         static uint64_t lastTime = 0;
@@ -271,6 +572,9 @@ void Renderer::commit() {
     }
 
     sg_commit(); 
+
+    //NOTE: sokol rewinds append position on commit, captures before frame pass append too
+    state.offscreen.instanceBytesUsed = 0;
 }
 
 Renderer::TextureHandle Renderer::createTexture(uint8_t* data, int width, int height, bool mipmaps) {
@@ -291,6 +595,24 @@ Renderer::TextureHandle Renderer::createTexture(uint8_t* data, int width, int he
     return { createdImage.id };
 }
 
+Renderer::TextureHandle Renderer::createIndexedTexture(uint8_t* indices, int width, int height) {
+    //NOTE: palette indices, filtering is done in shader after palette lookup
+    sg_image_desc imageDesc {};
+    imageDesc.width             = width;
+    imageDesc.height            = height;
+    imageDesc.pixel_format      = SG_PIXELFORMAT_R8;
+    imageDesc.wrap_u            = SG_WRAP_REPEAT;
+    imageDesc.wrap_v            = SG_WRAP_REPEAT;
+    imageDesc.min_filter        = SG_FILTER_NEAREST;
+    imageDesc.mag_filter        = SG_FILTER_NEAREST;
+    imageDesc.data.subimage[0][0] = { indices, static_cast<size_t>(width * height) };
+
+    sg_image createdImage {SG_INVALID_ID};
+    createdImage = sg_make_image(&imageDesc);
+    assert(createdImage.id != SG_INVALID_ID);
+    return { createdImage.id };
+}
+
 void Renderer::destroyTexture(TextureHandle textureHandle) {
     sg_destroy_image({ textureHandle.id });
 }
@@ -302,6 +624,7 @@ void Renderer::bindTexture(TextureHandle textureHandle, unsigned int slot) {
 
 void Renderer::bindMaterial(const Material& material) {
     state.material = material;
+    state.dirty.fsMaterial = true;
     
     if(material.diffuseTexture.has_value()) {
         bindTexture(material.diffuseTexture.value(), SLOT_universal_diffuseSampler);
@@ -320,6 +643,12 @@ void Renderer::bindMaterial(const Material& material) {
     } else {
         bindTexture({state.emptyTexture.id}, SLOT_universal_envSampler);
     }
+
+    if (material.paletteTexture.has_value()) {
+        bindTexture(material.paletteTexture.value(), SLOT_universal_paletteSampler);
+    } else {
+        bindTexture({state.emptyTexture.id}, SLOT_universal_paletteSampler);
+    }
 }
 
 Renderer::BufferHandle Renderer::createVertexBuffer(const std::vector<Vertex>& vertices) {
@@ -374,75 +703,125 @@ void Renderer::setIndexBuffer(BufferHandle handle) {
 }
 
 void Renderer::bindBuffers() {
-    if (state.pass == Renderer::RenderPass::ALPHA) {
-        sg_apply_pipeline(state.offscreen.alphaPip[state.material.isDoubleSided ? 0 : 1]);
-    } else {
-        sg_apply_pipeline(state.offscreen.pip[state.material.isDoubleSided ? 0 : 1]);
+    applyPipeline();
+    applyBindings();
+}
+
+void Renderer::applyPipeline() {
+    const auto variant = getShaderVariant(state.material.kind, state.bonesCount != 0);
+    const auto pipeline = state.offscreen.pipelines[getPipelineIndex(variant, state.pass, state.material.isDoubleSided)];
+    if (pipeline.id == state.applied.pipeline.id) {
+        gStats.pipelineSwitchesSkipped++;
+        return;
+    }
+
+    //NOTE: uniforms live in GL program, when shader changes
+    //blocks applied to previous one says nothing about new one
+    const auto shader = state.pass == RenderPass::WEIGHTED ? 
+        state.offscreen.oitShaders[static_cast<int>(variant)] : state.offscreen.shaders[static_cast<int>(variant)];
+    if (state.applied.shader.id != shader.id) {
+        memset(state.applied.uniformsValid, 0, sizeof(state.applied.uniformsValid));
+        state.dirty = { true, true, true, true, true };
+        state.applied.shader = shader;
+    }
+    state.applied.variant = variant;
+
+    //NOTE: bindings always follow new pipeline
+    sg_apply_pipeline(pipeline);
+    state.applied.pipeline = pipeline;
+    state.applied.bindingsValid = false;
+    gStats.pipelineSwitches++;
+}
+
+void Renderer::applyBindings() {
+    //NOTE: variants without env map don't declare env sampler
+    const bool hasEnv = state.applied.variant == ShaderVariant::STATIC_ENV || state.applied.variant == ShaderVariant::SKINNED_ENV;
+    if (!hasEnv) {
+        state.offscreen.bindings.fs_images[SLOT_universal_envSampler] = { SG_INVALID_ID };
+    }
+
+    if (state.applied.bindingsValid && memcmp(&state.applied.bindings, &state.offscreen.bindings, sizeof(sg_bindings)) == 0) {
+        gStats.bindingSwitchesSkipped++;
+        return;
     }
 
     sg_apply_bindings(&state.offscreen.bindings);
+    state.applied.bindings = state.offscreen.bindings;
+    state.applied.bindingsValid = true;
+    gStats.bindingSwitches++;
 }
 
-void Renderer::setModel(const glm::mat4& model) {
-    state.model = model;
+int Renderer::appendInstances(const glm::mat4* models, int count) {
+    const auto size = static_cast<int>(sizeof(glm::mat4)) * count;
+    if (state.offscreen.instanceBytesUsed + size > static_cast<int>(sizeof(glm::mat4)) * MaxInstances) {
+        return -1;
+    }
+
+    sg_range data { models, static_cast<size_t>(size) };
+    const auto offset = sg_append_buffer(state.offscreen.instanceBuffer, &data);
+    state.offscreen.instanceBytesUsed += size;
+    return offset / static_cast<int>(sizeof(glm::mat4));
+}
+
+void Renderer::setFirstInstance(int first) {
+    state.offscreen.bindings.vertex_buffers[1] = state.offscreen.instanceBuffer;
+    state.offscreen.bindings.vertex_buffer_offsets[1] = first * static_cast<int>(sizeof(glm::mat4));
 }
 
-void Renderer::setLights(const std::vector<Light>& lights) {
+void Renderer::setLights(const Light* lights, size_t count) {
     state.lights = lights;
+    state.lightsCount = count;
+    state.dirty.vsObject = true;
+    state.dirty.vsLights = true;
 }
 
-void Renderer::setBones(const std::vector<glm::mat4>& bones) {
+void Renderer::setBones(const glm::mat4* bones, size_t count) {
     state.bones = bones;
+    state.bonesCount = count;
+    state.dirty.vsBones = true;
 }
 
 void Renderer::applyUniforms() {
-    //NOTE: apply vertex stage uniforms
-    {
-        //NOTE since sokol uses only floating point uniforms
-        //we need to stick with that :/
-        const auto isBillboard = state.material.kind == MaterialKind::BILLBOARD ? 1.0f : 0.0f;
-        universal_vs_params_t vertexUniforms{};
-        vertexUniforms.model = state.model;
-        vertexUniforms.view = state.view;
-        vertexUniforms.projection = state.proj;
-        vertexUniforms.viewPos = state.viewPos;
-        vertexUniforms.billboard = isBillboard;
-        vertexUniforms.relative = state.isRelative ? 1.0f : 0.0f;
-        vertexUniforms.lightsCount = (float)state.lights.size();
-        vertexUniforms.bonesCount = (float)state.bones.size();
-        
-        //NOTE: set bones
-        memset(vertexUniforms.bones, 0, sizeof(glm::mat4) * MaxBones);
-        for(size_t i = 0; i < state.bones.size(); i++) {
-            vertexUniforms.bones[i] = state.bones[i];
+    //NOTE: only blocks touched since last draw are rebuilt and compared with
+    //what sokol already has, unchanged ones are skipped
+    //NOTE since sokol uses only floating point uniforms
+    //we need to stick with that :/
+
+    //NOTE: per frame block, changes with camera or layer only
+    if (state.dirty.vsFrame) {
+        universal_vs_frame_t vsFrame{};
+        vsFrame.view = state.view;
+        vsFrame.projection = state.proj;
+        vsFrame.viewPos = state.viewPos;
+        vsFrame.fogColor = glm::vec4(state.fogColor, 1.0f);
+        vsFrame.fogRange = state.fogRange;
+
+        //NOTE: things next to camera ( skybox ) drop view translation and fog
+        if (state.isRelative) {
+            vsFrame.view[3] = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+            vsFrame.fogRange = glm::vec2(0.0f);
         }
 
-        sg_range uniformsRange{
-            &vertexUniforms,
-            sizeof(universal_vs_params_t)
-        };
-
-        sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_universal_vs_params, &uniformsRange);
-
-        //NOTE: apply material
-        universal_vs_material_t vsMaterial{};
-        vsMaterial.ambient      = glm::vec4(state.material.ambient, 1.0f);
-        vsMaterial.diffuse      = glm::vec4(state.material.diffuse, 1.0f);
-        vsMaterial.emissive     = glm::vec4(state.material.emission, 1.0f);
+        applyUniformBlock(SG_SHADERSTAGE_VS, SLOT_universal_vs_frame, vsFrame, state.applied.vsFrame);
+    } else {
+        gStats.uniformUploadsSkipped++;
+    }
 
-        sg_range vsMaterialRange{
-            &vsMaterial,
-            sizeof(universal_vs_material_t)
-        };
-        
-        sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_universal_vs_material, &vsMaterialRange);
+    //NOTE: per object block
+    if (state.dirty.vsObject) {
+        universal_vs_object_t vsObject{};
+        vsObject.lightsCount = (float)state.lightsCount;
 
-        //NOTE: apply lights uniform
-        universal_vs_lights_t vsLights = {};
-        memset(&vsLights, 0, sizeof(universal_vs_lights_t));
+        applyUniformBlock(SG_SHADERSTAGE_VS, SLOT_universal_vs_object, vsObject, state.applied.vsObject);
+    } else {
+        gStats.uniformUploadsSkipped++;
+    }
 
+    //NOTE: apply lights uniform
+    if (state.dirty.vsLights) {
+        universal_vs_lights_t vsLights{};
         for(size_t i = 0; i < MaxLights; i++) {
-            if( i >= state.lights.size()) break;
+            if( i >= state.lightsCount) break;
             const auto& light = state.lights[i];
             vsLights.position[i]    = glm::vec4(light.position, (float)light.type);
             vsLights.dir[i]         = glm::vec4(light.dir, 0.0f);
@@ -452,42 +831,69 @@ void Renderer::applyUniforms() {
             vsLights.cone[i]        = glm::vec4(light.cone.x, light.cone.y, 0.0f, 0.0f);
         }
 
-        sg_range vsLightRange{
-            &vsLights,
-            sizeof(universal_vs_lights_t)
-        };
-        
-        sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_universal_vs_lights, &vsLightRange);
+        applyUniformBlock(SG_SHADERSTAGE_VS, SLOT_universal_vs_lights, vsLights, state.applied.vsLights);
+    } else {
+        gStats.uniformUploadsSkipped++;
     }
 
-    //NOTE: apply fragment state uniforms
-    {
-        universal_fs_params_t fsUniforms{};
-        fsUniforms.envMode = state.material.envTexture.has_value() ? static_cast<float>(state.material.envTextureBlending) : 3.0f;
-        fsUniforms.envRatio = state.material.envTextureBlendingRatio;
-        sg_range fsUniformsRange{
-            &fsUniforms,
-            sizeof(universal_fs_params_t)
-        };
-
-        sg_apply_uniforms(SG_SHADERSTAGE_FS, SLOT_universal_fs_params, &fsUniformsRange);
+    //NOTE: only skinned variants declare bones block,
+    //static draws never upload them
+    const bool isSkinned = state.applied.variant == ShaderVariant::SKINNED || state.applied.variant == ShaderVariant::SKINNED_ENV;
+    if (state.dirty.vsBones && isSkinned) {
+        universal_vs_bones_t vsBones{};
+        for(size_t i = 0; i < state.bonesCount && i < MaxBones; i++) {
+            vsBones.bones[i] = state.bones[i];
+        }
+
+        applyUniformBlock(SG_SHADERSTAGE_VS, SLOT_universal_vs_bones, vsBones, state.applied.vsBones);
+        state.dirty.vsBones = false;
+    }
+
+    //NOTE: per material block
+    if (state.dirty.fsMaterial) {
+        universal_fs_material_t fsMaterial{};
+        fsMaterial.ambient = glm::vec4(state.material.ambient, 1.0f);
+        fsMaterial.diffuse = glm::vec4(state.material.diffuse, state.material.transparency);
+        fsMaterial.emissive = glm::vec4(state.material.emission, 1.0f);
+        fsMaterial.envMode = state.material.envTexture.has_value() ? static_cast<float>(state.material.envTextureBlending) : 3.0f;
+        fsMaterial.envRatio = state.material.envTextureBlendingRatio;
+        fsMaterial.paletted = state.material.paletteTexture.has_value() ? 1.0f : 0.0f;
+
+        applyUniformBlock(SG_SHADERSTAGE_FS, SLOT_universal_fs_material, fsMaterial, state.applied.fsMaterial);
+    } else {
+        gStats.uniformUploadsSkipped++;
     }
+
+    state.dirty.vsFrame = false;
+    state.dirty.vsObject = false;
+    state.dirty.vsLights = false;
+    state.dirty.fsMaterial = false;
 }
 
 void Renderer::setViewMatrix(const glm::mat4 &view) {
     state.view = view;
+    state.dirty.vsFrame = true;
 }
 
 void Renderer::setProjMatrix(const glm::mat4 &proj) {
     state.proj = proj;
+    state.dirty.vsFrame = true;
 }
 
 void Renderer::setViewPos(const glm::vec3& pos) {
     state.viewPos = pos;
+    state.dirty.vsFrame = true;
+}
+
+void Renderer::setFog(const glm::vec3& color, const glm::vec2& range) {
+    state.fogColor = color;
+    state.fogRange = range;
+    state.dirty.vsFrame = true;
 }
 
 void Renderer::setCamRelative(bool relative) {
     state.isRelative = relative;
+    state.dirty.vsFrame = true;
 }
 
 bool Renderer::isCamRelative() {
@@ -496,6 +902,9 @@ bool Renderer::isCamRelative() {
 
 void Renderer::draw(int baseElement, int numElements, int numInstances) {
     sg_draw(baseElement, numElements, numInstances);
+    gStats.drawCalls++;
+    gStats.drawCallsUninstanced += numInstances;
+    gStats.instancedDraws += numInstances > 1;
 }
 
 Renderer::TextureHandle Renderer::getRenderTargetTexture() {
@@ -503,6 +912,65 @@ Renderer::TextureHandle Renderer::getRenderTargetTexture() {
     return { state.offscreen.colorImg.id };
 }
 
+Renderer::TextureHandle Renderer::createCaptureTexture(int width, int height) {
+    sg_image_desc imageDesc     = {};
+    imageDesc.render_target     = true;
+    imageDesc.width             = width;
+    imageDesc.height            = height;
+    imageDesc.pixel_format      = SG_PIXELFORMAT_RGBA8;
+    imageDesc.wrap_u            = SG_WRAP_CLAMP_TO_EDGE;
+    imageDesc.wrap_v            = SG_WRAP_CLAMP_TO_EDGE;
+    imageDesc.min_filter        = SG_FILTER_LINEAR;
+    imageDesc.mag_filter        = SG_FILTER_LINEAR;
+    imageDesc.label             = "capture-image";
+
+    sg_image createdImage = sg_make_image(&imageDesc);
+    assert(createdImage.id != SG_INVALID_ID);
+    return { createdImage.id };
+}
+
+void Renderer::beginCapture(TextureHandle texture, bool clear) {
+    const sg_image colorImg = { texture.id };
+    const auto info = sg_query_image_info(colorImg);
+
+    sg_image_desc depthImgDesc      = {};
+    depthImgDesc.render_target      = true;
+    depthImgDesc.width              = info.width;
+    depthImgDesc.height             = info.height;
+    depthImgDesc.pixel_format       = SG_PIXELFORMAT_DEPTH_STENCIL;
+    depthImgDesc.label              = "capture-depth-image";
+    state.capture.depthImg          = sg_make_image(&depthImgDesc);
+
+    sg_pass_desc passDesc = {};
+    passDesc.color_attachments[0].image = colorImg;
+    passDesc.depth_stencil_attachment.image = state.capture.depthImg;
+    passDesc.label = "capture-pass";
+    state.capture.pass = sg_make_pass(&passDesc);
+
+    //NOTE: transparent background, captures of previous frames are kept unless cleared
+    sg_pass_action passAction = {};
+    passAction.colors[0].action = clear ? SG_ACTION_CLEAR : SG_ACTION_LOAD;
+    passAction.colors[0].value = { 0.0f, 0.0f, 0.0f, 0.0f };
+    passAction.depth.action = SG_ACTION_CLEAR;
+    passAction.depth.value = 1.0f;
+
+    sg_begin_pass(state.capture.pass, &passAction);
+    invalidateAppliedState();
+    setPass(RenderPass::NORMAL);
+}
+
+void Renderer::setViewport(int x, int y, int width, int height) {
+    sg_apply_viewport(x, y, width, height, false);
+}
+
+void Renderer::endCapture() {
+    sg_end_pass();
+    sg_destroy_pass(state.capture.pass);
+    sg_destroy_image(state.capture.depthImg);
+    state.capture.pass = { SG_INVALID_ID };
+    state.capture.depthImg = { SG_INVALID_ID };
+}
+
 void Renderer::guiHandleSokolInput(const sapp_event* e) { 
     simgui_handle_event(e); 
 }
@@ -7,9 +7,19 @@ struct sapp_event;
 
 class Renderer {
 public:
+    //NOTE: render queue key holds NORMAL and ALPHA only, WEIGHTED is ALPHA list
+    //drawn into weighted blended OIT targets
     enum class RenderPass : uint64_t {
         NORMAL,
         ALPHA,
+        WEIGHTED,
+    };
+
+    static constexpr int PassCount = 3;
+
+    enum class TransparencyMode {
+        SORTED,
+        WEIGHTED
     };
 
     enum class MaterialKind {
@@ -26,8 +36,33 @@ public:
         ADD
     };
 
+    //NOTE: universal shader is compiled into variants, see universal.glsl
+    enum class ShaderVariant {
+        STATIC,
+        STATIC_ENV,
+        SKINNED,
+        SKINNED_ENV,
+        BILLBOARD,
+        COUNT
+    };
+
+    //NOTE: one pipeline for every variant, pass and culling mode
+    static constexpr int PipelineCount = static_cast<int>(ShaderVariant::COUNT) * PassCount * 2;
+
+    static constexpr ShaderVariant getShaderVariant(MaterialKind kind, bool skinned) {
+        if (kind == MaterialKind::BILLBOARD) return ShaderVariant::BILLBOARD;
+        const bool env = kind == MaterialKind::ENV;
+        if (skinned) return env ? ShaderVariant::SKINNED_ENV : ShaderVariant::SKINNED;
+        return env ? ShaderVariant::STATIC_ENV : ShaderVariant::STATIC;
+    }
+
+    static constexpr int getPipelineIndex(ShaderVariant variant, RenderPass pass, bool doubleSided) {
+        return (static_cast<int>(variant) * PassCount + static_cast<int>(pass)) * 2 + (doubleSided ? 0 : 1);
+    }
+
     static constexpr int MaxBones = 20;
     static constexpr int MaxLights = 15;
+    static constexpr int MaxInstances = 16384;
     static constexpr int InvalidHandle = 0;
     struct TextureHandle { uint32_t id; };  
     struct BufferHandle { uint32_t id; };
@@ -35,9 +70,10 @@ public:
         std::optional<TextureHandle> diffuseTexture;
         std::optional<TextureHandle> alphaTexture;
         std::optional<TextureHandle> envTexture;
+        std::optional<TextureHandle> paletteTexture;
         TextureBlending envTextureBlending;
         float envTextureBlendingRatio;
-        float transparency;
+        float transparency = 1.0f;
         glm::vec3 ambient = {1.0f, 1.0f, 1.0f};
         glm::vec3 diffuse = {1.0f, 1.0f, 1.0f};
         glm::vec3 emission = {1.0f, 1.0f, 1.0f};
@@ -74,7 +110,15 @@ public:
     static void end();
     static void commit();
 
+    //NOTE: weighted blended OIT, transparent draws between begin and end go to accumulation
+    //and revealage targets, end composites them over opaque image
+    static void setTransparencyMode(TransparencyMode mode);
+    static TransparencyMode getTransparencyMode();
+    static void beginWeightedTransparency();
+    static void endWeightedTransparency();
+
     static TextureHandle createTexture(uint8_t* data, int width, int height, bool mipmaps = false);
+    static TextureHandle createIndexedTexture(uint8_t* indices, int width, int height);
     static void destroyTexture(TextureHandle textureHandle);
     static void bindTexture(TextureHandle textureHandle, unsigned int slot);
     static void bindMaterial(const Material& material);
@@ -85,24 +129,39 @@ public:
     static void setVertexBuffer(BufferHandle handle);
     static void setIndexBuffer(BufferHandle handle);
     static void bindBuffers();
+    static void applyPipeline();
+    static void applyBindings();
 
     static void setCamRelative(bool relative);
     static bool isCamRelative();
 
-    static void setModel(const glm::mat4& model);
-    static void setLights(const std::vector<Light>& light);
-    static void setBones(const std::vector<glm::mat4>& bones);
+    //NOTE: model matrices go to per frame instance buffer, returns index of first
+    //appended instance or -1 when buffer is full, draws pick their range with setFirstInstance
+    static int appendInstances(const glm::mat4* models, int count);
+    static void setFirstInstance(int first);
+
+    //NOTE: lights and bones are not copied, data has to stay alive until draw
+    static void setLights(const Light* lights, size_t count);
+    static void setBones(const glm::mat4* bones, size_t count);
     static void applyUniforms();
 
     static void setViewMatrix(const glm::mat4& view);
     static void setProjMatrix(const glm::mat4& proj);
     static void setViewPos(const glm::vec3& pos);
+    static void setFog(const glm::vec3& color, const glm::vec2& range);
 
     static void draw(int baseElement, int numElements, int numInstances);
 
     static void createRenderTarget(int width, int height);
     static TextureHandle getRenderTargetTexture();
 
+    //NOTE: offscreen capture into texture ( impostor atlas ), called outside of frame pass,
+    //draws between begin and end go through universal pipelines into viewport of texture
+    static TextureHandle createCaptureTexture(int width, int height);
+    static void beginCapture(TextureHandle texture, bool clear);
+    static void setViewport(int x, int y, int width, int height);
+    static void endCapture();
+
     static void guiHandleSokolInput(const sapp_event* e);
     static int getWidth();
     static int getHeight();
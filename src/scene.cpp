@@ -14,12 +14,19 @@
 #include "light.hpp"
 #include "mesh.hpp"
 #include "gui.hpp"
+#include "occluder.hpp"
 #include "mafia/utils.hpp"
+#include "stats.hpp"
+
+#include <sokol/sokol_time.h>
 
 #include <functional>
 #include <memory>
 #include <unordered_map>
+#include <map>
 #include <algorithm>
+#include <cctype>
+#include <random>
 
 #include <glm/gtx/quaternion.hpp>
 #include <glm/gtx/matrix_decompose.hpp>
@@ -49,35 +56,76 @@ void Scene::createCameras(float fov, float nearPlane, float farPlane) {
 
 Sector* Scene::getCameraSector() {
     if(mActiveCamera != nullptr) {
-        std::optional<Sector*> foundSector;
-        getSectorOfPoint(mActiveCamera->getPos(), this, foundSector);
-        return foundSector.value_or(mPrimarySector.get());
+        mCameraSector = findSector(mActiveCamera->getPos(), mCameraSector);
+        return mCameraSector;
     }
     return nullptr;
 }
 
-void Scene::getSectorOfPoint(const glm::vec3& pos, Frame* node, std::optional<Sector*>& foundSector) {    
-    if (!node) return;
+//NOTE: sectors are linked and indexed once their transforms are final, portals go to world space
+void Scene::buildSectorIndex() {
+    mSectorIndex.clear();
+    mCameraSector = nullptr;
+    mSectors.clear();
+    linkSectors(mPrimarySector.get(), nullptr);
+
+    std::vector<Frame*> indexed;
+    for (size_t i = 0; i < mSectors.size(); i++) {
+        mSectors[i]->setIndex(static_cast<uint32_t>(i));
+        if (mSectors[i] != mPrimarySector.get()) {
+            indexed.push_back(mSectors[i]);
+        }
+    }
+
+    mSectorIndex.build(std::move(indexed));
+}
+
+Sector* Scene::findSector(const glm::vec3& pos, Sector* hint) {
+    mSectorLookupTests = 0;
+    mSectorLookupCoherent = false;
+
+    auto contains = [&](Sector* sector) {
+        if (sector == mPrimarySector.get()) return true;
+
+        const auto& box = sector->getWorldBBOX();
+        if (glm::any(glm::lessThan(pos, box.first)) || glm::any(glm::greaterThan(pos, box.second))) return false;
 
-    const auto isPointInsideAABB = [](const glm::vec3& point, const glm::vec3& min, const glm::vec3& max) -> bool {
-        return (point.x >= min.x && point.x <= max.x) && (point.y >= min.y && point.y <= max.y) && (point.z >= min.z && point.z <= max.z);
+        mSectorLookupTests++;
+        return sector->containsPoint(pos);
     };
 
-    if (node->getFrameType() == FrameType::Sector) {
-        const auto& sectorBBox = node->getBBOX();
-        const auto& mat = node->getWorldMatrix();
-        const auto min = glm::translate(mat, sectorBBox.first);
-        const auto max = glm::translate(mat, sectorBBox.second);
+    //NOTE: sector wins when none of its child sectors has point, deeper one would be picked otherwise
+    auto isDeepest = [&](Sector* sector) {
+        return std::none_of(sector->getChildSectors().begin(), sector->getChildSectors().end(), contains);
+    };
 
-        if (isPointInsideAABB(pos, min[3], max[3])) {
-            foundSector = reinterpret_cast<Sector*>(node);
+    //NOTE: primary sector neighbours every top level sector, index is faster there
+    auto* primary = mPrimarySector.get();
+    if (hint != nullptr && hint != primary) {
+        if (contains(hint) && isDeepest(hint)) {
+            mSectorLookupCoherent = true;
+            return hint;
         }
-    }
 
-    for (const auto& node : node->getChilds()) {
-        getSectorOfPoint(pos, node.get(), foundSector);
+        auto* parent = hint->getParentSector();
+        if (parent != nullptr && parent != primary && contains(parent) && isDeepest(parent)) {
+            mSectorLookupCoherent = true;
+            return parent;
+        }
     }
-};
+
+    //NOTE: sector list is in tree order, descendants come after ancestors so highest index is deepest
+    mSectorIndex.refit();
+    Sector* found = primary;
+    mSectorIndex.forEachContaining(pos, [&](Frame* frame) {
+        auto* sector = static_cast<Sector*>(frame);
+        if (sector->getIndex() > found->getIndex() && contains(sector)) {
+            found = sector;
+        }
+    });
+
+    return found;
+}
 
 std::unordered_map<std::string, std::vector<std::shared_ptr<Light>>> gLightsParenting;
 std::unordered_map<std::string, std::vector<std::shared_ptr<Sound>>> gSoundsParenting;
@@ -223,6 +271,7 @@ void Scene::load(const std::string& missionName) {
     std::shared_ptr<Sector> primarySector = std::make_shared<Sector>();
     
     auto loadedModel = ModelLoader::loadModel(scenePath.c_str(), "scene");
+    forEach<Mesh>([](Mesh* mesh) { mesh->setStatic(true); }, loadedModel.get());
     for (auto childNode : loadedModel->getChilds()) {
         primarySector->addChild(childNode);
     }
@@ -257,6 +306,10 @@ void Scene::load(const std::string& missionName) {
             case MFFormat::DataFormatScene2BIN::ObjectType::OBJECT_TYPE_SOUND: {
                 return loadSound(obj);
             } break;
+
+            case MFFormat::DataFormatScene2BIN::ObjectType::OBJECT_TYPE_OCCLUDER: {
+                return std::make_shared<Occluder>();
+            } break;
         }
 
         return std::make_shared<Frame>();
@@ -277,14 +330,7 @@ void Scene::load(const std::string& missionName) {
                 return "Primary sector";
             }
 
-            std::optional<Sector*> foundSector;
-            getSectorOfPoint(worldPosOfSector, this, foundSector);
-
-            if (foundSector.has_value()) {
-                return foundSector.value()->getName();
-            }
-
-            return "Primary sector";
+            return findSector(worldPosOfSector)->getName();
         }
         
         return parentName;
@@ -293,6 +339,10 @@ void Scene::load(const std::string& missionName) {
     std::vector<MFFormat::DataFormatScene2BIN::Object> patchObjects;
     MFFormat::DataFormatScene2BIN sceneBin;
 
+    //NOTE: objects without parent go to sector they are in, scene.4ds sectors are indexed for that
+    invalidateTransformRecursively();
+    buildSectorIndex();
+
     std::string sceneBinPath = missionFolder + "\\scene2.bin";
     auto sceneBinFile = Vfs::getFile(sceneBinPath);
     if (sceneBinFile.has_value()) {
@@ -403,6 +453,7 @@ void Scene::load(const std::string& missionName) {
     std::string sceneCacheBin = missionFolder + "\\cache.bin";
     MFFormat::DataFormatCacheBIN cacheBinFormat;
     auto cacheBinFile = Vfs::getFile(sceneCacheBin);
+    std::unordered_map<std::string, std::vector<Model*>> cacheInstances;
     if(cacheBinFile.has_value() && cacheBinFormat.load(cacheBinFile.value())) {
         for(const auto& obj : cacheBinFormat.getObjects()) {
             for(const auto& instance : obj.mInstances) {
@@ -416,6 +467,8 @@ void Scene::load(const std::string& missionName) {
                     meshRot.y = instance.mRot.y;
                     meshRot.z = instance.mRot.z;
                     model->setRot(meshRot);
+                    forEach<Mesh>([](Mesh* mesh) { mesh->setStatic(true); }, model.get());
+                    cacheInstances[instance.mModelName].push_back(model.get());
                     mPrimarySector->addChild(std::move(model));
                 }
             }
@@ -423,14 +476,41 @@ void Scene::load(const std::string& missionName) {
     }
 
     invalidateTransformRecursively();
+    mImpostors.build(cacheInstances);
     initVertexBuffers();
+    buildSectorIndex();
+
+    gStats.bvhNodes = 0;
+    for (auto* sector : mSectors) {
+        sector->buildBvh();
+        gStats.bvhNodes += static_cast<unsigned int>(sector->getBvh().getNodeCount());
+    }
+
+    mOccluders.clear();
+    forEach<Occluder>([this](Occluder* occluder) { mOccluders.push_back(occluder); }, this);
 
     auto clippingPlanes = sceneBin.getClippingPlanes();
+    loadPvs(clippingPlanes.x, clippingPlanes.y);
+
     auto fov = glm::degrees(sceneBin.getFov());
     createCameras(fov, clippingPlanes.x, clippingPlanes.y);
 }
 
 void Scene::clear() {
+    //NOTE: draw lists point into meshes about to be freed
+    for (auto& list : mDrawLists) {
+        list.queue.clear();
+        list.transparentQueue.clear();
+        list.isReady = false;
+    }
+
+    //NOTE: meshes point at impostors, atlas goes before frame tree
+    mImpostors.clear();
+    mSectorIndex.clear();
+    mCameraSector = nullptr;
+    mSectors.clear();
+    mOccluders.clear();
+    mPvs.clear();
     mPrimarySector = nullptr;
     mBackdropSector = nullptr;
     removeChilds();
@@ -464,29 +544,688 @@ void Scene::updateActiveCamera(float deltaTime) {
     }
 
     input->clearDeltas();
+}
 
-    Renderer::setViewMatrix(mActiveCamera->getMatrix());
-    Renderer::setViewPos(mActiveCamera->getPos());
+static bool gThreadedCullingEnabled = true;
+
+void Scene::setThreadedCullingEnabled(bool enabled) {
+    gThreadedCullingEnabled = enabled;
 }
 
-void Scene::render() {
-    const auto deltaTime = 16.0f;
-    
-    if(!mActiveCamera) return;    
-    updateActiveCamera(deltaTime);
+bool Scene::isThreadedCullingEnabled() {
+    return gThreadedCullingEnabled;
+}
+
+static bool gPortalCullingEnabled = true;
+static bool gBvhCullingEnabled = true;
+static bool gOcclusionCullingEnabled = true;
+static bool gPvsEnabled = false;
+static bool gLodEnabled = true;
+static float gLodBias = 1.0f;
+
+void Scene::setLodEnabled(bool enabled) {
+    gLodEnabled = enabled;
+}
+
+bool Scene::isLodEnabled() {
+    return gLodEnabled;
+}
+
+void Scene::setLodBias(float bias) {
+    gLodBias = bias;
+}
+
+float Scene::getLodBias() {
+    return gLodBias;
+}
+
+void Scene::setPvsEnabled(bool enabled) {
+    gPvsEnabled = enabled;
+}
+
+bool Scene::isPvsEnabled() {
+    return gPvsEnabled;
+}
+
+void Scene::setOcclusionCullingEnabled(bool enabled) {
+    gOcclusionCullingEnabled = enabled;
+}
+
+bool Scene::isOcclusionCullingEnabled() {
+    return gOcclusionCullingEnabled;
+}
+
+void Scene::setBvhCullingEnabled(bool enabled) {
+    gBvhCullingEnabled = enabled;
+}
+
+bool Scene::isBvhCullingEnabled() {
+    return gBvhCullingEnabled;
+}
+
+void Scene::setPortalCullingEnabled(bool enabled) {
+    gPortalCullingEnabled = enabled;
+}
+
+bool Scene::isPortalCullingEnabled() {
+    return gPortalCullingEnabled;
+}
+
+//NOTE: sectors may hang under plain frames, parent is nearest sector above
+void Scene::linkSectors(Frame* node, Sector* parentSector) {
+    if (node == nullptr) return;
+
+    if (node->getFrameType() == FrameType::Sector) {
+        auto* sector = reinterpret_cast<Sector*>(node);
+        sector->link(parentSector);
+        if (parentSector != nullptr) {
+            parentSector->addChildSector(sector);
+        }
+
+        mSectors.push_back(sector);
+        parentSector = sector;
+    }
+
+    for (const auto& child : node->getChilds()) {
+        linkSectors(child.get(), parentSector);
+    }
+}
+
+bool Scene::isSphereVisible(Sphere* sphere) {
+    if (mCullingBackdrop) return true;
+
+    //NOTE: subtree frame belongs to is inside of every plane
+    if (mCullFrusta != nullptr && mCullFrustaCount == 1 && mCullMask == 0) return true;
+
+    if (mCullFrusta != nullptr) {
+        for (size_t i = 0; i < mCullFrustaCount; i++) {
+            if (mCullFrusta[i].checkSphere(sphere)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    if (mActiveCamera != nullptr) {
+        return mActiveCamera->getFrustum().checkSphere(sphere);
+    }
+
+    return false;
+}
+
+bool Scene::isSubtreeVisible(const std::pair<glm::vec3, glm::vec3>& bounds) {
+    if (mCullingBackdrop || mCullFrusta == nullptr) return true;
+
+    mSubtreesTested++;
+    if (mCullFrustaCount == 1) {
+        const auto planeCount = static_cast<unsigned int>(mCullFrusta[0].planeCount);
+        const auto planeTests = static_cast<unsigned int>(std::popcount(mCullMask & ((1u << planeCount) - 1)));
+        mSubtreePlaneTests += planeTests;
+        mSubtreePlaneTestsSkipped += planeCount - planeTests;
+
+        if (mCullFrusta[0].checkAabbMasked(bounds.first, bounds.second, mCullMask)) return true;
+
+        mSubtreesCulled++;
+        return false;
+    }
+
+    //NOTE: seen through several portals, masks of different frusta don't combine
+    for (size_t i = 0; i < mCullFrustaCount; i++) {
+        auto mask = UINT32_MAX;
+        mSubtreePlaneTests += static_cast<unsigned int>(mCullFrusta[i].planeCount);
+        if (mCullFrusta[i].checkAabbMasked(bounds.first, bounds.second, mask)) return true;
+    }
+
+    mSubtreesCulled++;
+    return false;
+}
+
+//NOTE: child sectors are entered through their own portals, parent through ours,
+//sector without portals is open and shares frustum it was reached with
+void Scene::traversePortals(DrawList& list, Sector* sector, Sector* from, const PortalFrustum& frustum, int depth) {
+    if (mSectorVisits.size() >= MaxSectorVisits) return;
+    mSectorVisits.push_back({ sector, frustum });
+
+    if (depth >= MaxPortalDepth) return;
+
+    const auto& eye = list.view.viewPos;
+    auto enter = [&](Sector* target, const std::vector<Sector::Portal>& portals) {
+        if (target == nullptr || target == from || !target->isOn() || !isInPvs(target)) return;
+
+        if (portals.empty()) {
+            traversePortals(list, target, sector, frustum, depth + 1);
+            return;
+        }
+
+        for (const auto& portal : portals) {
+            list.portalsTested++;
+
+            PortalFrustum narrowed;
+            const auto count = static_cast<int>(portal.worldVertices.size());
+            if (frustum.narrow(eye, portal.worldVertices.data(), count, narrowed)) {
+                list.portalsPassed++;
+                traversePortals(list, target, sector, narrowed, depth + 1);
+            }
+        }
+    };
+
+    for (auto* child : sector->getChildSectors()) {
+        enter(child, child->getPortals());
+    }
+
+    enter(sector->getParentSector(), sector->getPortals());
+}
+
+Scene::~Scene() {
+    stopCull();
+}
+
+void Scene::startCull(DrawList& list) {
+    if (!mCull.thread.joinable()) {
+        mCull.thread = std::thread([this]() {
+            std::unique_lock<std::mutex> lock(mCull.mutex);
+            for (;;) {
+                mCull.wakeUp.wait(lock, [this]() { return mCull.stop || mCull.list != nullptr; });
+                if (mCull.stop) return;
+
+                auto* list = mCull.list;
+                lock.unlock();
+                buildDrawList(*list);
+                lock.lock();
+
+                mCull.list = nullptr;
+                mCull.busy = false;
+                mCull.done.notify_all();
+            }
+        });
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mCull.mutex);
+        mCull.list = &list;
+        mCull.busy = true;
+    }
+
+    mCull.wakeUp.notify_one();
+}
+
+void Scene::waitCull() {
+    std::unique_lock<std::mutex> lock(mCull.mutex);
+    mCull.done.wait(lock, [this]() { return !mCull.busy; });
+}
+
+void Scene::stopCull() {
+    if (!mCull.thread.joinable()) return;
 
-    auto drawRenderList = [&]() 
     {
+        std::lock_guard<std::mutex> lock(mCull.mutex);
+        mCull.stop = true;
+    }
+
+    mCull.wakeUp.notify_all();
+    mCull.thread.join();
+    mCull.stop = false;
+}
+
+//NOTE: runs on cull thread, touches scene graph and list only, never sokol
+void Scene::buildDrawList(DrawList& list) {
+    mCull.start = stm_now();
+    mCullFrame++;
+
+    const auto& view = list.view;
+
+    //NOTE: projected size of mesh on screen in pixels, drives texture mip residency
+    const auto screenScale = view.proj[1][1] * static_cast<float>(Renderer::getHeight());
+    auto getScreenSize = [&](Mesh* mesh, bool camRelative) 
+    {
+        auto* sphere = mesh->getSphere();
+        if (camRelative || sphere == nullptr) {
+            return static_cast<float>(Renderer::getHeight());
+        }
+
+        const auto dist = glm::length(sphere->center - view.viewPos);
+        if (dist <= sphere->radius) {
+            return static_cast<float>(Renderer::getHeight());
+        }
+
+        return sphere->radius / dist * screenScale;
+    };
+
+    //NOTE: lod distances are authored for reference fov, zoomed in view sees meshes bigger
+    //and keeps finer lods further, bias scales all of them
+    const auto lodDistanceScale = 1.0f / (glm::tan(glm::radians(LodReferenceFov) * 0.5f) * view.proj[1][1] * getLodBias());
+    list.lodTriangles = 0;
+    list.lodTrianglesFull = 0;
+    list.lodCoarserMeshes = 0;
+    list.impostorsDrawn = 0;
+    list.impostorMeshesReplaced = 0;
+
+    //NOTE: turn visible meshes into sorted draw commands
+    auto queueRenderList = [&](RenderQueue::Layer layer) 
+    {
+        const bool camRelative = layer == RenderQueue::Layer::BACKDROP;
         for(Mesh* mesh : mRenderList)
         {
-            Renderer::setLights(mesh->getLights());
-            Renderer::setModel(mesh->getWorldMatrix());
+            const auto* sphere = mesh->getSphere();
+            const auto depth = camRelative || sphere == nullptr ? 0.0f : glm::length(sphere->center - view.viewPos);
+            const auto screenSize = getScreenSize(mesh, camRelative);
+
+            size_t lod = 0;
+            if(!camRelative && isLodEnabled() && mesh->getLodCount() > 1) {
+                lod = mesh->selectLod(depth * lodDistanceScale);
+            }
+
+            if(lod > 0) {
+                list.lodCoarserMeshes++;
+            }
+
+            for(const auto& fgroup : mesh->getFaceGroups()) {
+                list.lodTrianglesFull += static_cast<unsigned int>(fgroup->getIndicesCount() / 3);
+            }
+
+            //NOTE: distant cache.bin instance is drawn as one captured quad instead of its meshes
+            auto* impostor = mesh->getImpostor();
+            if(!camRelative && ImpostorAtlas::isEnabled() && impostor != nullptr && impostor->isActive(view.viewPos, lodDistanceScale)) {
+                if(impostor->markQueued(mCullFrame)) {
+                    list.queue.push(impostor, impostor->selectFaceGroup(view.viewPos), layer, Renderer::RenderPass::NORMAL, depth);
+                    list.lodTriangles += 2;
+                    list.impostorsDrawn++;
+                }
+
+                list.impostorMeshesReplaced++;
+                continue;
+            }
 
-            for(const auto& fgroup : mesh->getFaceGroups()) 
+            for(const auto& fgroup : mesh->getLodFaceGroups(lod)) 
             {
-                fgroup->render();   
+                list.lodTriangles += static_cast<unsigned int>(fgroup->getIndicesCount() / 3);
+
+                const auto& material = fgroup->getMaterial();
+                if(material) {
+                    material->requestTextureSize(screenSize);
+                }
+
+                //NOTE: backdrop is drawn before world with own projection, its transparent parts stay cutout
+                if(!camRelative && material && material->isTransparent()) {
+                    list.transparentQueue.push(mesh, fgroup.get(), layer, Renderer::RenderPass::ALPHA, depth);
+                } else {
+                    list.queue.push(mesh, fgroup.get(), layer, Renderer::RenderPass::NORMAL, depth);
+                }
             }
         }
+
+        mRenderList.clear();
+    };
+
+    list.queue.clear();
+    list.transparentQueue.clear();
+    mRenderList = decltype(mRenderList)();
+    mRenderList.reserve(mLastRenderListSize);
+
+    //NOTE: skybox -> Backdrop sector first
+    mCullingBackdrop = true;
+    if(mBackdropSector != nullptr) {
+        mBackdropSector->render();
+    }
+
+    mLastRenderListSize = mRenderList.size();
+    queueRenderList(RenderQueue::Layer::BACKDROP);
+    mCullingBackdrop = false;
+
+    //NOTE: walk sectors from the one camera is in, each is culled by union of frusta it was seen through
+    list.sectorsVisited = 0;
+    list.portalsTested = 0;
+    list.portalsPassed = 0;
+    mSectorVisits = decltype(mSectorVisits)();
+
+    //NOTE: meshes moved since last cull refit their path in sector bvh
+    list.bvhLeavesRefit = 0;
+    list.bvhNodesTested = 0;
+    for(auto* sector : mSectors) {
+        list.bvhLeavesRefit += sector->refitBvh();
+    }
+
+    PortalFrustum cameraFrustum;
+    cameraFrustum.set(mActiveCamera->getFrustum());
+
+    //NOTE: sectors camera sector never saw are skipped, meshes are left to portal and bvh culling
+    auto* cameraSector = getCameraSector();
+    list.sectorLookupTests = mSectorLookupTests;
+    list.isSectorLookupCoherent = mSectorLookupCoherent;
+
+    const bool isPvsRow = isPvsEnabled() && cameraSector != nullptr && mPvs.hasRow(cameraSector->getIndex());
+
+    //NOTE: frame tree walk skips subtrees whose cached bounds are outside cull frusta
+    mSubtreesTested = 0;
+    mSubtreesCulled = 0;
+    mSubtreePlaneTests = 0;
+    mSubtreePlaneTestsSkipped = 0;
+    mPvsRow = isPvsRow ? cameraSector->getIndex() : NoPvsRow;
+    list.pvsSectors = isPvsRow ? static_cast<unsigned int>(mPvs.getVisibleSectorCount(mPvsRow)) : 0;
+
+    if(isPortalCullingEnabled() && cameraSector != nullptr) {
+        traversePortals(list, cameraSector, nullptr, cameraFrustum, 0);
+
+        std::sort(mSectorVisits.begin(), mSectorVisits.end(), [](const SectorVisit& a, const SectorVisit& b) {
+            return a.sector < b.sector;
+        });
+
+        //NOTE: frusta of one sector have to be contiguous for bvh
+        FrameVector<PortalFrustum> frusta;
+        frusta.reserve(mSectorVisits.size());
+        for(const auto& visit : mSectorVisits) {
+            frusta.push_back(visit.frustum);
+        }
+
+        mPortalTraversal = true;
+        for(size_t i = 0; i < mSectorVisits.size();) {
+            size_t end = i + 1;
+            while(end < mSectorVisits.size() && mSectorVisits[end].sector == mSectorVisits[i].sector) {
+                end++;
+            }
+
+            mCullFrusta = &frusta[i];
+            mCullFrustaCount = end - i;
+            mCullMask = UINT32_MAX;
+            list.bvhNodesTested += mSectorVisits[i].sector->renderContents(mCullFrusta, mCullFrustaCount);
+            list.sectorsVisited++;
+            i = end;
+        }
+
+        mCullFrusta = nullptr;
+        mCullFrustaCount = 0;
+        mPortalTraversal = false;
+    } else if(isBvhCullingEnabled()) {
+        for(auto* sector : mSectors) {
+            if(sector->isOnRecursively() && isInPvs(sector)) {
+                list.bvhNodesTested += sector->renderContents(&cameraFrustum, 1);
+                list.sectorsVisited++;
+            }
+        }
+    } else if(mPrimarySector != nullptr) {
+        mCullFrusta = &cameraFrustum;
+        mCullFrustaCount = 1;
+        mCullMask = UINT32_MAX;
+        mPrimarySector->render();
+        list.sectorsVisited = static_cast<unsigned int>(mSectors.size());
+
+        mCullFrusta = nullptr;
+        mCullFrustaCount = 0;
+    }
+
+    list.subtreesTested = mSubtreesTested;
+    list.subtreesCulled = mSubtreesCulled;
+    list.subtreePlaneTests = mSubtreePlaneTests;
+    list.subtreePlaneTestsSkipped = mSubtreePlaneTestsSkipped;
+
+    mSectorVisits.clear();
+
+    mLastRenderListSize = std::max(mLastRenderListSize, mRenderList.size());
+    list.occluders = 0;
+    list.occluderTriangles = 0;
+    list.occlusionTested = 0;
+    list.occluded = 0;
+    list.occlusionMs = 0.0f;
+    list.occlusionRasterMs = 0.0f;
+    if(isOcclusionCullingEnabled()) {
+        cullOccluded(list, cameraFrustum);
+    }
+
+    queueRenderList(RenderQueue::Layer::WORLD);
+
+    list.queue.sort();
+    list.queue.build();
+
+    const auto transparentStart = stm_now();
+    list.transparentQueue.sort();
+    list.transparentQueue.build();
+    list.transparentBuildMs = static_cast<float>(stm_ms(stm_since(transparentStart)));
+    list.isReady = true;
+
+    mCull.end = stm_now();
+}
+
+//NOTE: biggest meshes on screen occlude the rest of render list, runs on cull thread
+void Scene::cullOccluded(DrawList& list, const PortalFrustum& cameraFrustum) {
+    const auto start = stm_now();
+    const auto& view = list.view;
+    mOcclusion.begin(view.proj * view.view);
+
+    FrameVector<std::pair<float, Mesh*>> candidates;
+    for(Mesh* mesh : mRenderList) {
+        auto* sphere = mesh->getSphere();
+        if(sphere == nullptr || !OcclusionCuller::isOccluderCandidate(mesh)) continue;
+
+        const auto dist = glm::length(sphere->center - view.viewPos);
+        const auto size = dist <= sphere->radius ? std::numeric_limits<float>::max() : sphere->radius / dist;
+        if(size >= OcclusionCuller::MinOccluderSize) {
+            candidates.emplace_back(size, mesh);
+        }
+    }
+
+    const auto count = std::min(candidates.size(), OcclusionCuller::MaxOccluders);
+    std::partial_sort(candidates.begin(), candidates.begin() + count, candidates.end(), [](const auto& a, const auto& b) {
+        return a.first > b.first;
+    });
+
+    for(size_t i = 0; i < count; i++) {
+        mOcclusion.addOccluder(candidates[i].second);
+    }
+
+    for(auto* occluder : mOccluders) {
+        if(occluder->isOnRecursively() && occluder->getSphere() != nullptr && cameraFrustum.checkSphere(occluder->getSphere())) {
+            mOcclusion.addOccluderBox(occluder->getWorldMatrix(), occluder->getBBOX());
+        }
+    }
+
+    const auto rasterStart = stm_now();
+    mOcclusion.rasterize();
+    list.occlusionRasterMs = static_cast<float>(stm_ms(stm_since(rasterStart)));
+
+    //NOTE: occluders test against themselves too, conservative depth never lets them hide
+    list.occlusionTested = static_cast<unsigned int>(mRenderList.size());
+    mRenderList.erase(std::remove_if(mRenderList.begin(), mRenderList.end(), [this](Mesh* mesh) {
+        return mOcclusion.isOccluded(mesh->getWorldBBOX());
+    }), mRenderList.end());
+
+    list.occluded = list.occlusionTested - static_cast<unsigned int>(mRenderList.size());
+    list.occluders = mOcclusion.getOccluderCount();
+    list.occluderTriangles = mOcclusion.getTriangleCount();
+    list.occlusionMs = static_cast<float>(stm_ms(stm_since(start)));
+}
+
+//NOTE: mission name can hold path separators, cache is one flat folder
+static std::string getPvsCachePath(const std::string& missionName) {
+    auto fileName = missionName;
+    std::replace_if(fileName.begin(), fileName.end(), [](char c) { return !std::isalnum(static_cast<unsigned char>(c)); }, '_');
+    return "pvs/" + fileName + ".pvs";
+}
+
+//NOTE: static meshes get their PVS index, cached PVS is used when key of everything bake
+//depends on ( sectors, portals, static meshes and their placement, clipping ) matches
+void Scene::loadPvs(float nearPlane, float farPlane) {
+    const auto start = stm_now();
+
+    uint64_t key = 0xcbf29ce484222325ull;
+    auto hashValue = [&key](const auto& value) { key = Pvs::hash(key, &value, sizeof(value)); };
+    auto hashString = [&key](const std::string& value) { key = Pvs::hash(key, value.data(), value.size()); };
+
+    hashValue(Pvs::Version);
+    hashValue(nearPlane);
+    hashValue(farPlane);
+    for (auto* sector : mSectors) {
+        hashString(sector->getName());
+        hashValue(sector->getWorldBBOX());
+        for (const auto& portal : sector->getPortals()) {
+            key = Pvs::hash(key, portal.worldVertices.data(), portal.worldVertices.size() * sizeof(glm::vec3));
+        }
+    }
+
+    uint32_t meshCount = 0;
+    forEach<Mesh>([&](Mesh* mesh) {
+        mesh->setPvsIndex(Mesh::NoPvsIndex);
+        if (!mesh->isStatic()) return;
+
+        mesh->setPvsIndex(meshCount++);
+        hashString(mesh->getName());
+        hashValue(mesh->getWorldMatrix());
+    }, mPrimarySector.get());
+
+    const auto path = getPvsCachePath(getName());
+    gStats.pvsFromCache = mPvs.load(path, key) && mPvs.getSectorCount() == mSectors.size() && mPvs.getMeshCount() == meshCount;
+    if (!gStats.pvsFromCache) {
+        mPvs.reset(mSectors.size(), meshCount, key);
+        bakePvs(nearPlane, farPlane);
+
+        if (!mPvs.save(path)) {
+            Logger::get().warn("unable to write PVS cache: {}", path);
+        }
+    }
+
+    gStats.pvsMs = static_cast<float>(stm_ms(stm_since(start)));
+    Logger::get().info("PVS of {} sectors and {} static meshes {} in {:.1f} ms", mSectors.size(), meshCount, gStats.pvsFromCache ? "loaded" : "baked", gStats.pvsMs);
+}
+
+//NOTE: samples points inside every sector bounds, from each one six 90 degree views are
+//culled through portals like in frame, everything they reach goes to row of sector point is in
+void Scene::bakePvs(float nearPlane, float farPlane) {
+    const auto proj = glm::perspectiveLH(glm::half_pi<float>(), 1.0f, nearPlane, farPlane);
+    const glm::vec3 dirs[6] = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+    const glm::vec3 ups[6] = { { 0, 1, 0 }, { 0, 1, 0 }, { 0, 0, 1 }, { 0, 0, 1 }, { 0, 1, 0 }, { 0, 1, 0 } };
+
+    //NOTE: arena could be rewound since last use, capacity is reused only inside bake
+    mSectorVisits = decltype(mSectorVisits)();
+    mPvsVisible = decltype(mPvsVisible)();
+    mPvsRow = NoPvsRow;
+
+    DrawList scratch;
+    for (size_t i = 0; i < mSectors.size(); i++) {
+        const auto& box = mSectors[i]->getWorldBBOX();
+        if (isEmptyAABB(box)) continue;
+
+        const auto size = box.second - box.first;
+        const auto cells = glm::ceil(size / PvsSampleSpacing);
+        const auto cellCount = std::min(cells.x * cells.y * cells.z, static_cast<float>(PvsMaxSamples));
+        const auto samples = std::max(static_cast<size_t>(cellCount), PvsMinSamples);
+
+        std::mt19937 random(static_cast<uint32_t>(i));
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        for (size_t sample = 0; sample < samples; sample++) {
+            const auto eye = box.first + size * glm::vec3(unit(random), unit(random), unit(random));
+            auto* from = findSector(eye);
+            scratch.view.viewPos = eye;
+            mPvs.addSample(from->getIndex());
+
+            for (int face = 0; face < 6; face++) {
+                Frustum frustum;
+                frustum.update(proj * glm::lookAtLH(eye, eye + dirs[face], ups[face]));
+
+                PortalFrustum portalFrustum;
+                portalFrustum.set(frustum);
+                collectVisible(scratch, from, portalFrustum, mPvs, from->getIndex());
+            }
+        }
+    }
+}
+
+//NOTE: same portal traversal and bvh cull as frame uses, marks what was reached into row
+void Scene::collectVisible(DrawList& scratch, Sector* from, const PortalFrustum& frustum, Pvs& pvs, size_t row) {
+    mSectorVisits.clear();
+    traversePortals(scratch, from, nullptr, frustum, 0);
+
+    for (const auto& visit : mSectorVisits) {
+        pvs.markSector(row, visit.sector->getIndex());
+
+        mPvsVisible.clear();
+        visit.sector->getBvh().cull(&visit.frustum, 1, mPvsVisible);
+        for (auto* frame : mPvsVisible) {
+            const auto index = static_cast<Mesh*>(frame)->getPvsIndex();
+            if (index != Mesh::NoPvsIndex) {
+                pvs.markMesh(row, index);
+            }
+        }
+    }
+
+    mSectorVisits.clear();
+}
+
+bool Scene::isInPvs(const Sector* sector) const {
+    return mPvsRow == NoPvsRow || mPvs.isSectorVisible(mPvsRow, sector->getIndex());
+}
+
+Scene::PvsValidation Scene::validatePvs(size_t samples) {
+    PvsValidation result;
+    if (!mPvs.isBaked() || mActiveCamera == nullptr || mSectors.empty()) return result;
+
+    const auto start = stm_now();
+    mSectorVisits = decltype(mSectorVisits)();
+    mPvsVisible = decltype(mPvsVisible)();
+    mPvsRow = NoPvsRow;
+
+    std::mt19937 random(std::random_device{}());
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::uniform_int_distribution<size_t> pickSector(0, mSectors.size() - 1);
+
+    Pvs reference;
+    DrawList scratch;
+    for (size_t sample = 0; sample < samples; sample++) {
+        const auto& box = mSectors[pickSector(random)]->getWorldBBOX();
+        if (isEmptyAABB(box)) continue;
+
+        const auto eye = box.first + (box.second - box.first) * glm::vec3(unit(random), unit(random), unit(random));
+        auto* from = findSector(eye);
+        const auto row = from->getIndex();
+        if (!mPvs.hasRow(row)) {
+            result.unsampled++;
+            continue;
+        }
+
+        const auto yaw = unit(random) * glm::two_pi<float>();
+        const auto pitch = (unit(random) - 0.5f) * glm::radians(160.0f);
+        const glm::vec3 dir(std::cos(yaw) * std::cos(pitch), std::sin(pitch), std::sin(yaw) * std::cos(pitch));
+
+        Frustum frustum;
+        frustum.update(mActiveCamera->getProjMatrix() * glm::lookAtLH(eye, eye + dir, glm::vec3(0.0f, 1.0f, 0.0f)));
+
+        PortalFrustum portalFrustum;
+        portalFrustum.set(frustum);
+        scratch.view.viewPos = eye;
+        reference.reset(mPvs.getSectorCount(), mPvs.getMeshCount(), 0);
+        collectVisible(scratch, from, portalFrustum, reference, 0);
+
+        for (size_t i = 0; i < reference.getSectorCount(); i++) {
+            if (!reference.isSectorVisible(0, i)) continue;
+            result.visibleSectors++;
+            result.missedSectors += mPvs.isSectorVisible(row, i) ? 0 : 1;
+        }
+
+        for (size_t i = 0; i < reference.getMeshCount(); i++) {
+            if (!reference.isMeshVisible(0, i)) continue;
+            result.visibleMeshes++;
+            result.missedMeshes += mPvs.isMeshVisible(row, i) ? 0 : 1;
+        }
+
+        result.pvsMeshes += mPvs.getVisibleMeshCount(row);
+        result.samples++;
+    }
+
+    result.ms = static_cast<float>(stm_ms(stm_since(start)));
+    return result;
+}
+
+//NOTE: runs on main thread, reads only what list snapshotted
+void Scene::submitDrawList(DrawList& list) {
+    if (!list.isReady) return;
+
+    const auto& view = list.view;
+    Renderer::setViewMatrix(view.view);
+    Renderer::setViewPos(view.viewPos);
+    Renderer::setFog(view.fogColor, view.fogRange);
+
+    auto beginLayer = [&](RenderQueue::Layer layer) {
+        const bool camRelative = layer == RenderQueue::Layer::BACKDROP;
+        Renderer::setCamRelative(camRelative);
+        Renderer::setProjMatrix(camRelative ? view.skyboxProj : view.proj);
     };
 
     //NOTE: normal pass -> render normal objects
@@ -499,29 +1238,22 @@ void Scene::render() {
             Renderer::setIndexBuffer(mIndexBuffer);
         }
 
-        //NOTE: skybox pass -> render Backdrop sector first
-        Renderer::setCamRelative(true);
-        Renderer::setProjMatrix(mActiveCamera->getSkyboxProjMatrix());
-
-        if(mBackdropSector != nullptr) {
-            mBackdropSector->render();
-        }
-
-        drawRenderList();
-        mRenderList.clear();
+        list.queue.submit(beginLayer);
 
         Renderer::setCamRelative(false);
-        Renderer::setProjMatrix(mActiveCamera->getProjMatrix());
-
-        if(mPrimarySector != nullptr) {
-            mPrimarySector->render();
-        }
+        Renderer::setProjMatrix(view.proj);
+    }
 
-        drawRenderList();
+    //NOTE: transparency pass -> blended face groups over opaques, 
+    //back to front or into weighted blended OIT targets
+    const auto transparentStart = stm_now();
+    const bool isWeighted = list.transparencyMode == Renderer::TransparencyMode::WEIGHTED;
+    if (isWeighted) {
+        Renderer::beginWeightedTransparency();
+    } else {
+        Renderer::setPass(Renderer::RenderPass::ALPHA);
     }
 
-    //NOTE: transparency pass, alpha blending, sorting, etc ...
-    Renderer::setPass(Renderer::RenderPass::ALPHA);
     {
         //NOTE: bind buffers
         if (mVertexBuffer.id != Renderer::InvalidHandle && 
@@ -530,31 +1262,237 @@ void Scene::render() {
             Renderer::setIndexBuffer(mIndexBuffer);
         }
 
-        Renderer::setProjMatrix(mActiveCamera->getProjMatrix());
+        list.transparentQueue.submit(beginLayer);
+
+        Renderer::setCamRelative(false);
+        Renderer::setProjMatrix(view.proj);
+    }
+
+    if (isWeighted) {
+        Renderer::endWeightedTransparency();
     }
 
-    mRenderList.clear();
+    gStats.transparentBuildMs = list.transparentBuildMs;
+    gStats.sectorsVisited = list.sectorsVisited;
+    gStats.sectorsTotal = static_cast<unsigned int>(mSectors.size());
+    gStats.portalsTested = list.portalsTested;
+    gStats.portalsPassed = list.portalsPassed;
+    gStats.bvhNodesTested = list.bvhNodesTested;
+    gStats.bvhLeavesRefit = list.bvhLeavesRefit;
+    gStats.occluders = list.occluders;
+    gStats.occluderTriangles = list.occluderTriangles;
+    gStats.occlusionTested = list.occlusionTested;
+    gStats.occluded = list.occluded;
+    gStats.occlusionMs = list.occlusionMs;
+    gStats.occlusionRasterMs = list.occlusionRasterMs;
+    gStats.lodTriangles = list.lodTriangles;
+    gStats.lodTrianglesFull = list.lodTrianglesFull;
+    gStats.lodCoarserMeshes = list.lodCoarserMeshes;
+    gStats.impostorsDrawn = list.impostorsDrawn;
+    gStats.impostorMeshesReplaced = list.impostorMeshesReplaced;
+    gStats.subtreesTested = list.subtreesTested;
+    gStats.subtreesCulled = list.subtreesCulled;
+    gStats.subtreePlaneTests = list.subtreePlaneTests;
+    gStats.subtreePlaneTestsSkipped = list.subtreePlaneTestsSkipped;
+    gStats.sectorLookupTests = list.sectorLookupTests;
+    gStats.isSectorLookupCoherent = list.isSectorLookupCoherent;
+    gStats.pvsSectors = list.pvsSectors;
+    gStats.transparentSubmitMs = static_cast<float>(stm_ms(stm_since(transparentStart)));
+}
+
+void Scene::render() {
+    const auto deltaTime = 16.0f;
+    
+    if(!mActiveCamera) return;    
+    updateActiveCamera(deltaTime);
+
+    //NOTE: list culled now is submitted next frame, camera lags one frame behind
+    auto& submitList = mDrawLists[mSubmitList];
+    auto& cullList = mDrawLists[mSubmitList ^ 1];
+
+    auto& view = cullList.view;
+    view.view = mActiveCamera->getMatrix();
+    view.proj = mActiveCamera->getProjMatrix();
+    view.skyboxProj = mActiveCamera->getSkyboxProjMatrix();
+    view.viewPos = mActiveCamera->getPos();
+
+    //NOTE: fog is per frame state, taken from sector camera was in last cull
+    view.fogColor = glm::vec3{ 0.0f };
+    view.fogRange = glm::vec2{ 0.0f };
+    if(mCurrentSector != nullptr) {
+        for(const auto& light : mCurrentSector->getLights()) {
+            if(light->getType() == LightType::Fog) {
+                view.fogColor = light->getDiffuse();
+                view.fogRange = light->getRange();
+                break;
+            }
+        }
+    }
+
+    cullList.transparencyMode = Renderer::getTransparencyMode();
+
+    const bool threaded = gThreadedCullingEnabled;
+    if (threaded) {
+        startCull(cullList);
+    } else {
+        buildDrawList(cullList);
+    }
+
+    const auto submitStart = stm_now();
+    submitDrawList(submitList);
+    const auto submitEnd = stm_now();
+
+    if (threaded) {
+        waitCull();
+    }
+
+    gStats.cullMs = static_cast<float>(stm_ms(stm_diff(mCull.end, mCull.start)));
+    gStats.submitMs = static_cast<float>(stm_ms(stm_diff(submitEnd, submitStart)));
+    const auto overlapStart = std::max(mCull.start, submitStart);
+    const auto overlapEnd = std::min(mCull.end, submitEnd);
+    gStats.overlapMs = threaded && overlapEnd > overlapStart ? static_cast<float>(stm_ms(overlapEnd - overlapStart)) : 0.0f;
+
+    mSubmitList ^= 1;
 
     //NOTE: debug render
     this->debugRender();
     Gui::debugRender(this);
 }
 
-void Scene::initVertexBuffers() {
+void Scene::bakeStaticBatches() {
+    //NOTE: geometry placed more times stays shared and is drawn instanced instead
+    std::unordered_map<std::string, size_t> geometryUses;
     forEach<Mesh>([&](Mesh* mesh) {
-        const auto& vertices = mesh->getVertices();
-        const auto currentVerticesCount = static_cast<uint32_t>(mVertices.size());
-        mVertices.insert(mVertices.end(), vertices.begin(), vertices.end());
+        if (!mesh->getGeometryKey().empty()) {
+            geometryUses[mesh->getGeometryKey()]++;
+        }
+    }, this);
+
+    //NOTE: one batch for every sector and material, in order of first appearance
+    struct Batch {
+        std::vector<std::pair<Mesh*, FaceGroup*>> members;
+    };
+
+    std::vector<Batch> batches;
+    std::map<std::pair<Sector*, Material*>, size_t> batchLookup;
+
+    forEach<Mesh>([&](Mesh* mesh) {
+        if (!mesh->isStatic() || mesh->getFrameType() != FrameType::Mesh || mesh->getVertices().empty()) return;
+        if (!mesh->getGeometryKey().empty() && geometryUses[mesh->getGeometryKey()] > 1) return;
+
+        //NOTE: meshes with lod chain switch lods on their own, baked batch would pin lod 0
+        if (mesh->getLodCount() > 1) return;
+
+        Sector* sector = nullptr;
+        for (auto* owner = mesh->getOwner(); owner != nullptr; owner = owner->getOwner()) {
+            if (owner->getFrameType() == FrameType::Sector) {
+                sector = static_cast<Sector*>(owner);
+                break;
+            }
+        }
 
         for (const auto& faceGroup : mesh->getFaceGroups()) {
-            const auto currentIndicesCount = mIndices.size();
+            const auto [it, inserted] = batchLookup.try_emplace({ sector, faceGroup->getMaterial().get() }, batches.size());
+            if (inserted) {
+                batches.emplace_back();
+            }
+            batches[it->second].members.emplace_back(mesh, faceGroup.get());
+        }
+    }, this);
+
+    //NOTE: vertices are pre transformed into world space once per mesh,
+    //indices of every batch are laid out contiguously so neighbouring members can be drawn at once
+    std::unordered_map<Mesh*, uint32_t> vertexBases;
+    uint32_t batchId = 0;
+    for (const auto& batch : batches) {
+        batchId++;
+        for (const auto& [mesh, faceGroup] : batch.members) {
+            auto [it, inserted] = vertexBases.try_emplace(mesh, static_cast<uint32_t>(mVertices.size()));
+            if (inserted) {
+                const auto& world = mesh->getWorldMatrix();
+                const auto normalMatrix = glm::mat3(glm::transpose(glm::inverse(world)));
+                for (auto vertex : mesh->getVertices()) {
+                    vertex.p = glm::vec3(world * glm::vec4(vertex.p, 1.0f));
+                    vertex.n = glm::normalize(normalMatrix * vertex.n);
+                    mVertices.push_back(vertex);
+                }
+            }
+
+            faceGroup->setOffset(mIndices.size());
+            faceGroup->setStaticBatch(batchId);
             for (auto i : faceGroup->getIndices()) {
-                mIndices.push_back(i + currentVerticesCount);
+                mIndices.push_back(i + it->second);
+            }
+        }
+    }
+
+    for (const auto& [mesh, base] : vertexBases) {
+        mesh->setBaked(mesh->getWorldMatrix());
+    }
+
+    gStats.staticBatches = batchId;
+    gStats.staticBatchedMeshes = static_cast<unsigned int>(vertexBases.size());
+    Logger::get().info("baked {} static meshes into {} batches", vertexBases.size(), batchId);
+}
+
+void Scene::initVertexBuffers() {
+    bakeStaticBatches();
+
+    //NOTE: instances of same model reuse index ranges of first one,
+    //render queue merges draws of equal ranges into instanced draws
+    std::unordered_map<std::string, std::vector<size_t>> sharedOffsets;
+
+    forEach<Mesh>([&](Mesh* mesh) {
+        if (mesh->isBaked()) return;
+
+        //NOTE: face groups of every lod one after another
+        std::vector<FaceGroup*> faceGroups;
+        for (size_t lod = 0; lod < mesh->getLodCount(); lod++) {
+            for (const auto& faceGroup : mesh->getLodFaceGroups(lod)) {
+                faceGroups.push_back(faceGroup.get());
+            }
+        }
+
+        const auto& geometryKey = mesh->getGeometryKey();
+        if (!geometryKey.empty()) {
+            const auto it = sharedOffsets.find(geometryKey);
+            if (it != sharedOffsets.end() && it->second.size() == faceGroups.size()) {
+                for (size_t i = 0; i < faceGroups.size(); i++) {
+                    faceGroups[i]->setOffset(it->second[i]);
+                }
+                return;
+            }
+        }
+
+        for (size_t lod = 0; lod < mesh->getLodCount(); lod++) {
+            const auto& vertices = mesh->getLodVertices(lod);
+            const auto currentVerticesCount = static_cast<uint32_t>(mVertices.size());
+            mVertices.insert(mVertices.end(), vertices.begin(), vertices.end());
+
+            for (const auto& faceGroup : mesh->getLodFaceGroups(lod)) {
+                const auto currentIndicesCount = mIndices.size();
+                for (auto i : faceGroup->getIndices()) {
+                    mIndices.push_back(i + currentVerticesCount);
+                }
+                faceGroup->setOffset(currentIndicesCount);
+            }
+        }
+
+        if (!geometryKey.empty()) {
+            auto& offsets = sharedOffsets[geometryKey];
+            for (auto* faceGroup : faceGroups) {
+                offsets.push_back(faceGroup->getOffset());
             }
-            faceGroup->setOffset(currentIndicesCount);
         }
     }, this);
 
+    mImpostors.appendGeometry(mVertices, mIndices);
+
     mIndexBuffer = Renderer::createIndexBuffer(mIndices);
     mVertexBuffer = Renderer::createVertexBuffer(mVertices);
+}
+
+void Scene::updateImpostors() {
+    if(mIndexBuffer.id == Renderer::InvalidHandle || mVertexBuffer.id == Renderer::InvalidHandle) return;
+    mImpostors.update(mPrimarySector.get(), mVertexBuffer, mIndexBuffer);
 }
\ No newline at end of file
@@ -2,12 +2,22 @@
 #include <memory>
 #include <string>
 #include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include "mafia/parser_cachebin.hpp"
 #include "mafia/parser_scene2bin.hpp"
 
 #include "model.hpp"
 #include "renderer.hpp"
+#include "render_queue.hpp"
+#include "frame_arena.hpp"
+#include "bvh.hpp"
+#include "frustum_culling.h"
+#include "occlusion_culler.hpp"
+#include "pvs.hpp"
+#include "impostor.hpp"
 
 class Light;
 class Material;
@@ -19,6 +29,8 @@ class Mesh;
 
 class Scene : public Model {
 public:
+    ~Scene();
+
     [[nodiscard]] Camera* getActiveCamera() { return mActiveCamera; }
     void setActiveCamera(Camera* cam) { mActiveCamera = cam; }
 
@@ -33,12 +45,145 @@ public:
     void clear();
     void render();
 
+    //NOTE: render thread before frame pass, captures impostors of models whose textures streamed in
+    void updateImpostors();
+
     void addToRenderList(Mesh* frameToPush) { mRenderList.push_back(frameToPush); }
+
+    //NOTE: backdrop is drawn around camera, frustum test does not apply
+    [[nodiscard]] bool isCullingBackdrop() const { return mCullingBackdrop; }
+
+    //NOTE: sectors are reached through portals, Sector::render does not recurse
+    [[nodiscard]] bool isPortalTraversal() const { return mPortalTraversal; }
+
+    //NOTE: tests against frusta sector was seen through, or camera frustum
+    [[nodiscard]] bool isSphereVisible(Sphere* sphere);
+
+    //NOTE: hierarchical culling of frame tree walk, cull mask holds planes of single cull
+    //frustum subtree still crosses, subtree test narrows it for children
+    [[nodiscard]] bool isSubtreeVisible(const std::pair<glm::vec3, glm::vec3>& bounds);
+    [[nodiscard]] uint32_t getCullMask() const { return mCullMask; }
+    void setCullMask(uint32_t mask) { mCullMask = mask; }
+
+    static void setThreadedCullingEnabled(bool enabled);
+    static bool isThreadedCullingEnabled();
+
+    static void setPortalCullingEnabled(bool enabled);
+    static bool isPortalCullingEnabled();
+
+    //NOTE: sectors cull their meshes with bvh instead of walking frame tree
+    static void setBvhCullingEnabled(bool enabled);
+    static bool isBvhCullingEnabled();
+
+    //NOTE: visible meshes are tested against software rasterized occluders before queueing
+    static void setOcclusionCullingEnabled(bool enabled);
+    static bool isOcclusionCullingEnabled();
+
+    //NOTE: culling starts from PVS of camera sector, sectors outside are skipped, baked from samples
+    //so it isn't conservative and is off until validation shows no missed sectors
+    static void setPvsEnabled(bool enabled);
+    static bool isPvsEnabled();
+
+    //NOTE: meshes draw coarser 4DS lods with distance, bias above 1 keeps finer lods further
+    static void setLodEnabled(bool enabled);
+    static bool isLodEnabled();
+    static void setLodBias(float bias);
+    static float getLodBias();
+
+    //NOTE: random views compared with per frame portal culling from the same spot,
+    //missed are visible things PVS doesn't have ( they would pop in )
+    struct PvsValidation {
+        size_t samples = 0;
+        size_t unsampled = 0;
+        size_t visibleSectors = 0;
+        size_t missedSectors = 0;
+        size_t visibleMeshes = 0;
+        size_t missedMeshes = 0;
+        size_t pvsMeshes = 0;
+        float ms = 0.0f;
+    };
+
+    PvsValidation validatePvs(size_t samples);
 private:
+    static constexpr size_t NoPvsRow = SIZE_MAX;
+    static constexpr float LodReferenceFov = 65.0f;
+    static constexpr float PvsSampleSpacing = 20.0f;
+    static constexpr size_t PvsMinSamples = 8;
+    static constexpr size_t PvsMaxSamples = 512;
+
+    static constexpr int MaxPortalDepth = 16;
+    static constexpr size_t MaxSectorVisits = 256;
+
+    //NOTE: sector seen through chain of portals with frustum narrowed by them
+    struct SectorVisit {
+        Sector* sector;
+        PortalFrustum frustum;
+    };
+
+    //NOTE: camera state draw list was culled with, applied when the list is submitted
+    struct FrameView {
+        glm::mat4 view{ 1.0f };
+        glm::mat4 proj{ 1.0f };
+        glm::mat4 skyboxProj{ 1.0f };
+        glm::vec3 viewPos{ 0.0f };
+        glm::vec3 fogColor{ 0.0f };
+        glm::vec2 fogRange{ 0.0f };
+    };
+
+    //NOTE: cull thread fills one list while main thread submits the other
+    struct DrawList {
+        RenderQueue queue;
+        RenderQueue transparentQueue;
+        FrameView view;
+        Renderer::TransparencyMode transparencyMode = Renderer::TransparencyMode::SORTED;
+        float transparentBuildMs = 0.0f;
+        unsigned int sectorsVisited = 0;
+        unsigned int portalsTested = 0;
+        unsigned int portalsPassed = 0;
+        unsigned int bvhNodesTested = 0;
+        unsigned int bvhLeavesRefit = 0;
+        unsigned int occluders = 0;
+        unsigned int occluderTriangles = 0;
+        unsigned int occlusionTested = 0;
+        unsigned int occluded = 0;
+        float occlusionMs = 0.0f;
+        float occlusionRasterMs = 0.0f;
+        unsigned int lodTriangles = 0;
+        unsigned int lodTrianglesFull = 0;
+        unsigned int lodCoarserMeshes = 0;
+        unsigned int impostorsDrawn = 0;
+        unsigned int impostorMeshesReplaced = 0;
+        unsigned int subtreesTested = 0;
+        unsigned int subtreesCulled = 0;
+        unsigned int subtreePlaneTests = 0;
+        unsigned int subtreePlaneTestsSkipped = 0;
+        unsigned int sectorLookupTests = 0;
+        bool isSectorLookupCoherent = false;
+        unsigned int pvsSectors = 0;
+        bool isReady = false;
+    };
+
+    void buildDrawList(DrawList& list);
+    void submitDrawList(DrawList& list);
+    void cullOccluded(DrawList& list, const PortalFrustum& cameraFrustum);
+    void traversePortals(DrawList& list, Sector* sector, Sector* from, const PortalFrustum& frustum, int depth);
+    void linkSectors(Frame* node, Sector* parentSector);
+    void loadPvs(float nearPlane, float farPlane);
+    void bakePvs(float nearPlane, float farPlane);
+    void collectVisible(DrawList& scratch, Sector* from, const PortalFrustum& frustum, Pvs& pvs, size_t row);
+    [[nodiscard]] bool isInPvs(const Sector* sector) const;
+    void buildSectorIndex();
+
+    //NOTE: deepest sector containing point, primary sector when there is none. Hint ( sector
+    //of last lookup ) and its neighbours are checked before sector index
+    [[nodiscard]] Sector* findSector(const glm::vec3& pos, Sector* hint = nullptr);
+    void startCull(DrawList& list);
+    void waitCull();
+    void stopCull();
     void createCameras(float fov, float near, float far);
     void updateActiveCamera(float deltaTime);
     void initVertexBuffers();
-    void getSectorOfPoint(const glm::vec3& pos, Frame* node, std::optional<Sector*>& foundSector);
+    void bakeStaticBatches();
     std::shared_ptr<Sound> loadSound(const MFFormat::DataFormatScene2BIN::Object& object);
     std::shared_ptr<Light> loadLight(const MFFormat::DataFormatScene2BIN::Object& object);
     std::shared_ptr<Sector> loadSector(const MFFormat::DataFormatScene2BIN::Object& object);
@@ -53,5 +198,49 @@ private:
 
     Renderer::BufferHandle mVertexBuffer{ 0 };
     Renderer::BufferHandle mIndexBuffer{ 0 };
-    std::vector<Mesh*> mRenderList;
+    FrameVector<Mesh*> mRenderList;
+    size_t mLastRenderListSize = 0;
+    DrawList mDrawLists[2];
+    size_t mSubmitList = 0;
+    bool mCullingBackdrop = false;
+
+    std::vector<Sector*> mSectors;
+
+    //NOTE: bvh over world bounds of sectors except primary one, that is the fallback
+    Bvh mSectorIndex;
+    Sector* mCameraSector{ nullptr };
+    unsigned int mSectorLookupTests = 0;
+    bool mSectorLookupCoherent = false;
+    FrameVector<SectorVisit> mSectorVisits;
+    const PortalFrustum* mCullFrusta{ nullptr };
+    size_t mCullFrustaCount = 0;
+    uint32_t mCullMask = UINT32_MAX;
+    unsigned int mSubtreesTested = 0;
+    unsigned int mSubtreesCulled = 0;
+    unsigned int mSubtreePlaneTests = 0;
+    unsigned int mSubtreePlaneTestsSkipped = 0;
+    bool mPortalTraversal = false;
+
+    //NOTE: scene2 occluder objects, owned by scene graph
+    std::vector<Frame*> mOccluders;
+    OcclusionCuller mOcclusion;
+
+    Pvs mPvs;
+    size_t mPvsRow = NoPvsRow;
+    FrameVector<Frame*> mPvsVisible;
+
+    ImpostorAtlas mImpostors;
+    uint64_t mCullFrame = 0;
+
+    struct {
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable wakeUp;
+        std::condition_variable done;
+        DrawList* list = nullptr;
+        bool busy = false;
+        bool stop = false;
+        uint64_t start = 0;
+        uint64_t end = 0;
+    } mCull;
 };
\ No newline at end of file
@@ -3,10 +3,14 @@
 #include "scene.hpp"
 #include "app.hpp"
 #include "sound.hpp"
+#include "mesh.hpp"
 
 void Sector::render() {
     //if(!isVisible()) return;
     if(!mOn) return;
+
+    //NOTE: portal traversal decides which sectors get rendered
+    if(App::get()->getScene()->isPortalTraversal()) return;
     
     for(const auto& frame : mChilds) {
         if(frame->getFrameType() == FrameType::Sector) {
@@ -23,6 +27,137 @@ void Sector::render() {
     }
 }
 
+unsigned int Sector::renderContents(const PortalFrustum* frusta, size_t count) {
+    if(!mOn) return 0;
+
+    auto* scene = App::get()->getScene();
+    scene->setCurrentSector(this);
+
+    if(!Scene::isBvhCullingEnabled()) {
+        for(const auto& frame : mChilds) {
+            if(frame->getFrameType() != FrameType::Sector) {
+                frame->render();
+            }
+        }
+        return 0;
+    }
+
+    //NOTE: frames with per frame work which is not culling ( sounds )
+    for(auto* frame : mUpdateFrames) {
+        frame->render();
+    }
+
+    FrameVector<Frame*> visible;
+    visible.reserve(mBvh.getFrameCount());
+    const auto nodesTested = mBvh.cull(frusta, count, visible);
+
+    for(auto* frame : visible) {
+        if(frame->isOnRecursively()) {
+            static_cast<Mesh*>(frame)->renderVisible();
+        }
+    }
+
+    return nodesTested;
+}
+
+void Sector::buildBvh() {
+    std::vector<Frame*> meshes;
+    mUpdateFrames.clear();
+
+    std::function<void(Frame*)> collect = [&](Frame* frame) {
+        for(const auto& child : frame->getChilds()) {
+            const auto type = child->getFrameType();
+            if(type == FrameType::Sector) continue;
+
+            if(dynamic_cast<Mesh*>(child.get()) != nullptr) {
+                meshes.push_back(child.get());
+            } else if(type == FrameType::Sound) {
+                mUpdateFrames.push_back(child.get());
+            }
+
+            collect(child.get());
+        }
+    };
+
+    collect(this);
+    mBvh.build(std::move(meshes));
+}
+
+void Sector::link(Sector* parentSector) {
+    mParentSector = parentSector;
+    mChildSectors.clear();
+
+    const auto& world = getWorldMatrix();
+    mWorldToLocal = glm::inverse(world);
+    for(auto& portal : mPortals) {
+        portal.worldVertices.clear();
+        for(const auto& vertex : portal.vertices) {
+            portal.worldVertices.push_back(glm::vec3(world * glm::vec4(vertex, 1.0f)));
+        }
+    }
+}
+
+void Sector::setHull(const std::vector<glm::vec3>& vertices, const std::vector<glm::u16vec3>& faces) {
+    mHullPlanes.clear();
+    if (vertices.size() < 4) return;
+
+    glm::vec3 center(0.0f);
+    glm::vec3 min(std::numeric_limits<float>::max());
+    glm::vec3 max(std::numeric_limits<float>::lowest());
+    for (const auto& vertex : vertices) {
+        center += vertex;
+        min = glm::min(min, vertex);
+        max = glm::max(max, vertex);
+    }
+    center /= static_cast<float>(vertices.size());
+
+    const auto epsilon = glm::length(max - min) * 1e-3f;
+    for (const auto& face : faces) {
+        if (face.x >= vertices.size() || face.y >= vertices.size() || face.z >= vertices.size()) continue;
+
+        const auto& a = vertices[face.x];
+        const auto normal = glm::cross(vertices[face.y] - a, vertices[face.z] - a);
+        if (glm::length(normal) < 1e-6f) continue;
+
+        //NOTE: winding of sector meshes is not reliable, planes face away from center
+        glm::vec4 plane(glm::normalize(normal), 0.0f);
+        plane.w = -glm::dot(glm::vec3(plane), a);
+        if (glm::dot(glm::vec3(plane), center) + plane.w > 0.0f) {
+            plane = -plane;
+        }
+
+        const auto isDuplicate = std::any_of(mHullPlanes.begin(), mHullPlanes.end(), [&](const glm::vec4& other) {
+            return glm::dot(glm::vec3(other), glm::vec3(plane)) > 0.9999f && std::abs(other.w - plane.w) < epsilon;
+        });
+
+        if (!isDuplicate) {
+            mHullPlanes.push_back(plane);
+        }
+    }
+
+    //NOTE: concave mesh is no hull, sector falls back to its box
+    for (const auto& plane : mHullPlanes) {
+        for (const auto& vertex : vertices) {
+            if (glm::dot(glm::vec3(plane), vertex) + plane.w > epsilon) {
+                mHullPlanes.clear();
+                return;
+            }
+        }
+    }
+}
+
+bool Sector::containsPoint(const glm::vec3& point) const {
+    const auto local = glm::vec3(mWorldToLocal * glm::vec4(point, 1.0f));
+    const auto& box = getBBOX();
+    if (glm::any(glm::lessThan(local, box.first)) || glm::any(glm::greaterThan(local, box.second))) return false;
+
+    for (const auto& plane : mHullPlanes) {
+        if (glm::dot(glm::vec3(plane), local) + plane.w > 0.0f) return false;
+    }
+
+    return true;
+}
+
 void Sector::pushLight(std::shared_ptr<Light> light) {
     mSectorLights.push_back(light);
 }
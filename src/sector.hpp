@@ -1,19 +1,64 @@
 #include "frame.hpp"
+#include "bvh.hpp"
 #include <vector>
 
 class Light;
 class Sound;
+class PortalFrustum;
 class Sector : public Frame {
 public:
+    //NOTE: polygon leading from sector out to its parent sector
+    struct Portal {
+        std::vector<glm::vec3> vertices;
+        std::vector<glm::vec3> worldVertices;
+    };
+
     [[nodiscard]] constexpr FrameType getFrameType() const override { return FrameType::Sector; }
     void render() override;
 
+    //NOTE: renders everything inside except child sectors, those are reached through portals,
+    //frusta are the ones sector is seen through, returns count of tested bvh nodes
+    unsigned int renderContents(const PortalFrustum* frusta, size_t count);
+
+    //NOTE: bvh over meshes of this sector, child sectors have their own
+    void buildBvh();
+    uint32_t refitBvh() { return mBvh.refit(); }
+    [[nodiscard]] const Bvh& getBvh() const { return mBvh; }
+
     void pushLight(std::shared_ptr<Light> light);
     [[nodiscard]] const std::vector<std::shared_ptr<Light>>& getLights() { return mSectorLights; }
 
     void pushSound(std::shared_ptr<Sound> sound);
     [[nodiscard]] const std::vector<std::shared_ptr<Sound>>& getSounds() { return mSectorSounds; }
+
+    void setPortals(std::vector<Portal> portals) { mPortals = std::move(portals); }
+    [[nodiscard]] const std::vector<Portal>& getPortals() const { return mPortals; }
+
+    //NOTE: called once scene is loaded and transforms are final, moves portals to world space
+    void link(Sector* parentSector);
+    void addChildSector(Sector* sector) { mChildSectors.push_back(sector); }
+    [[nodiscard]] Sector* getParentSector() const { return mParentSector; }
+    [[nodiscard]] const std::vector<Sector*>& getChildSectors() const { return mChildSectors; }
+
+    //NOTE: planes of sector mesh from 4ds in sector space, kept only when mesh is convex
+    void setHull(const std::vector<glm::vec3>& vertices, const std::vector<glm::u16vec3>& faces);
+    [[nodiscard]] size_t getHullPlaneCount() const { return mHullPlanes.size(); }
+
+    //NOTE: point is moved to sector space, has to be inside sector box and its hull
+    [[nodiscard]] bool containsPoint(const glm::vec3& point) const;
+
+    //NOTE: position in scene sector list, row of mission PVS
+    void setIndex(uint32_t index) { mIndex = index; }
+    [[nodiscard]] uint32_t getIndex() const { return mIndex; }
 private:
     std::vector<std::shared_ptr<Light>> mSectorLights;
     std::vector<std::shared_ptr<Sound>> mSectorSounds;
+    std::vector<Portal> mPortals;
+    std::vector<Sector*> mChildSectors;
+    Sector* mParentSector{ nullptr };
+    uint32_t mIndex = 0;
+    glm::mat4 mWorldToLocal{ 1.0f };
+    std::vector<glm::vec4> mHullPlanes;
+    Bvh mBvh;
+    std::vector<Frame*> mUpdateFrames;
 };
\ No newline at end of file
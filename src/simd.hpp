@@ -0,0 +1,13 @@
+#pragma once
+
+//NOTE: SSE is baseline on x64, AVX is compiled per function and picked at runtime
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define CULL_SSE 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+        #define CULL_AVX_TARGET
+    #else
+        #define CULL_AVX_TARGET __attribute__((target("avx")))
+    #endif
+#endif
\ No newline at end of file
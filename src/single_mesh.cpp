@@ -10,10 +10,12 @@ SingleMesh::SingleMesh() {
     //mAnimator->open("!!!Skakani.5DS");
 }
 
-void SingleMesh::render() {
+void SingleMesh::renderVisible() {
     //mAnimator->update();
 
-    std::vector<glm::mat4> bones{};
+    //NOTE: mesh is drawn later from render queue, keep palette with mesh
+    auto& bones = mBoneMatrices;
+    bones.clear();
     for(auto& boneDef : mBones) {
         bones.push_back(boneDef.mInverseTransform);
     }
@@ -26,7 +28,5 @@ void SingleMesh::render() {
         }        
     }, this);
 
-    Renderer::setBones(bones);
-    Mesh::render();
-    Renderer::setBones({});
+    Mesh::renderVisible();
 }
\ No newline at end of file
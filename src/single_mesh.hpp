@@ -32,7 +32,8 @@ public:
     void setBones(std::vector<Bone> bones) { mBones = std::move(bones); }
     [[nodiscard]] const std::vector<Bone>& getBones() const { return mBones; }
 
-    virtual void render() override;
+    //NOTE: skinning palette is built only for meshes which passed culling
+    virtual void renderVisible() override;
 private:
     std::shared_ptr<Animator> mAnimator{ nullptr };
     std::vector<Bone> mBones;
@@ -0,0 +1,29 @@
+#include "stats.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+//NOTE: global operator new is replaced only to count calls, memory still comes from malloc
+static std::atomic<uint64_t> gHeapAllocations{ 0 };
+
+uint64_t getHeapAllocationCount() {
+    return gHeapAllocations.load(std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size) {
+    gHeapAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size != 0 ? size : 1)) {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
\ No newline at end of file
@@ -1,9 +1,75 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
+
 struct Stats {
     unsigned int framesInUse;
     unsigned int billboardsInUse;
     unsigned int modelsInUse;
     unsigned int texturesInUse;
+    unsigned int texturesDeduped;
+    size_t textureBytesInUse;
+    size_t textureBytesDeduped;
+    unsigned int staticBatches;
+    unsigned int staticBatchedMeshes;
+    unsigned int bvhNodes;
+    float pvsMs;
+    bool pvsFromCache;
+
+    //NOTE: per frame, reset in Renderer::begin
+    unsigned int drawCalls;
+    unsigned int drawCallsUninstanced;
+    unsigned int instancedDraws;
+    unsigned int staticBatchDraws;
+    unsigned int staticBatchMembers;
+    unsigned int transparentDraws;
+    unsigned int pipelineSwitches;
+    unsigned int bindingSwitches;
+    unsigned int pipelineSwitchesUnsorted;
+    unsigned int bindingSwitchesUnsorted;
+    unsigned int pipelineSwitchesSkipped;
+    unsigned int bindingSwitchesSkipped;
+    unsigned int uniformUploads;
+    unsigned int uniformUploadsSkipped;
+    float cullMs;
+    float submitMs;
+    float overlapMs;
+    float transparentBuildMs;
+    float transparentSubmitMs;
+    unsigned int sectorsVisited;
+    unsigned int sectorsTotal;
+    unsigned int portalsTested;
+    unsigned int portalsPassed;
+    unsigned int bvhNodesTested;
+    unsigned int bvhLeavesRefit;
+    unsigned int occluders;
+    unsigned int occluderTriangles;
+    unsigned int occlusionTested;
+    unsigned int occluded;
+    float occlusionMs;
+    float occlusionRasterMs;
+    unsigned int lodTriangles;
+    unsigned int lodTrianglesFull;
+    unsigned int lodCoarserMeshes;
+    unsigned int impostorsDrawn;
+    unsigned int impostorMeshesReplaced;
+    unsigned int impostorModels;
+    unsigned int impostorModelsCaptured;
+    unsigned int impostorInstances;
+    unsigned int impostorAtlasSize;
+    unsigned int subtreesTested;
+    unsigned int subtreesCulled;
+    unsigned int subtreePlaneTests;
+    unsigned int subtreePlaneTestsSkipped;
+    unsigned int sectorLookupTests;
+    bool isSectorLookupCoherent;
+    unsigned int pvsSectors;
+    unsigned int heapAllocations;
+    size_t frameArenaBytes;
+    size_t frameArenaCapacity;
 };
 
-extern Stats gStats;
\ No newline at end of file
+extern Stats gStats;
+
+//NOTE: operator new calls since start, counted in stats.cpp
+uint64_t getHeapAllocationCount();
@@ -5,54 +5,525 @@
 #include "texture.hpp"
 #include "renderer.hpp"
 #include "bmp_loader.hpp"
+#include "logger.hpp"
 #include "vfs.hpp"
 
 #include <filesystem>
 #include <fstream>
 #include <unordered_map>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <deque>
+#include <algorithm>
+#include <cmath>
 
-std::unordered_map<std::string, Texture*> gTextureCache;
+//NOTE: GPU images are owned by content key ( hash of file + decode flags )
+//so identical images stored under different names share one GPU image
+struct TextureKey {
+    uint64_t contentHash;
+    bool useTransparencyKey;
+    bool mipmaps;
+    bool paletted;
+    bool operator==(const TextureKey& other) const = default;
+};
+
+struct TextureAlias {
+    std::string fileName;
+    bool useTransparencyKey;
+    bool mipmaps;
+    bool paletted;
+    bool operator==(const TextureAlias& other) const = default;
+};
+
+struct TextureKeyHasher {
+    size_t operator()(const TextureKey& key) const {
+        return key.contentHash ^ (static_cast<size_t>(key.paletted) << 2) ^ (static_cast<size_t>(key.useTransparencyKey) << 1) ^ static_cast<size_t>(key.mipmaps);
+    }
+
+    size_t operator()(const TextureAlias& alias) const {
+        return std::hash<std::string>{}(alias.fileName) ^ (static_cast<size_t>(alias.paletted) << 2) ^ (static_cast<size_t>(alias.useTransparencyKey) << 1) ^ static_cast<size_t>(alias.mipmaps);
+    }
+};
+
+//NOTE: every requested name + flags owns its Texture object, content cache
+//points to the texture that owns GPU image for given content
+std::unordered_map<TextureAlias, Texture*, TextureKeyHasher> gTextureAliases;
+std::unordered_map<TextureKey, Texture*, TextureKeyHasher> gTextureCache;
+
+//NOTE: textures are kept resident at reduced resolution when they are far away,
+//upgrades happen right away, downgrades only after texture was not needed for a while
+constexpr int MinResidentSize = 64;
+constexpr uint64_t ResidencyHysteresisFrames = 120;
+constexpr size_t MaxResidencyJobsPerFrame = 32;
+constexpr size_t PaletteSize = 256 * 4;
+
+static bool gPalettedEnabled = true;
+
+static struct {
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    std::deque<Texture*> toDecode;
+    std::deque<Texture*> toUpload;
+    size_t uploadBudget = 8 * 1024 * 1024;
+    size_t residencyBudget = 256 * 1024 * 1024;
+    size_t pendingCount = 0;
+    size_t pendingResidencyCount = 0;
+    uint64_t frameIdx = 0;
+    Stats statsAtStart{};
+    bool stop = false;
+} gStreaming;
+
+//NOTE: FNV-1a, good enough to tell BMPs apart
+static uint64_t hashContent(const MFUtil::ScopedBuffer& buffer) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    const auto* data = reinterpret_cast<const uint8_t*>(*buffer);
+    for (size_t i = 0; i < buffer.size(); i++) {
+        hash ^= data[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+//NOTE: box filter RGBA8 image down by given amount of levels
+static uint8_t* downsample(const uint8_t* src, int width, int height, int levels) {
+    uint8_t* result = nullptr;
+    for (int level = 0; level < levels; level++) {
+        const int dstWidth = std::max(width >> 1, 1);
+        const int dstHeight = std::max(height >> 1, 1);
+        auto* dst = new uint8_t[dstWidth * dstHeight * 4];
+
+        for (int y = 0; y < dstHeight; y++) {
+            const int y0 = std::min(y * 2, height - 1);
+            const int y1 = std::min(y * 2 + 1, height - 1);
+            for (int x = 0; x < dstWidth; x++) {
+                const int x0 = std::min(x * 2, width - 1);
+                const int x1 = std::min(x * 2 + 1, width - 1);
+                for (int c = 0; c < 4; c++) {
+                    const int sum = src[(y0 * width + x0) * 4 + c] + src[(y0 * width + x1) * 4 + c] +
+                                    src[(y1 * width + x0) * 4 + c] + src[(y1 * width + x1) * 4 + c];
+                    dst[(y * dstWidth + x) * 4 + c] = static_cast<uint8_t>(sum / 4);
+                }
+            }
+        }
+
+        delete[] result;
+        result = dst;
+        src = dst;
+        width = dstWidth;
+        height = dstHeight;
+    }
+
+    return result;
+}
 
 void Texture::clearCache() {
-    for(auto& [textureName, texture] : gTextureCache) {
+    {
+        std::lock_guard<std::mutex> lock(gStreaming.mutex);
+        gStreaming.stop = true;
+    }
+
+    gStreaming.wakeUp.notify_all();
+    for (auto& worker : gStreaming.workers) {
+        worker.join();
+    }
+
+    gStreaming.workers.clear();
+    gStreaming.toDecode.clear();
+    gStreaming.toUpload.clear();
+    gStreaming.pendingCount = 0;
+    gStreaming.pendingResidencyCount = 0;
+    gStreaming.stop = false;
+
+    for(auto& [textureAlias, texture] : gTextureAliases) {
         if(texture != nullptr) {
             delete texture;
         }
     }
 
     gTextureCache.clear();
+    gTextureAliases.clear();
+    gStats.texturesDeduped = 0;
+    gStats.textureBytesDeduped = 0;
+}
+
+Texture* Texture::loadFromFile(const std::string& fileName, bool useTransparencyKey, bool mipmaps, bool paletted) {
+    //NOTE: indices can't be mipmapped, such textures stay RGBA
+    paletted = paletted && !mipmaps;
+
+    //NOTE: same name with same decode flags was already requested
+    const TextureAlias alias { MFUtil::strToLower(fileName), useTransparencyKey, mipmaps, paletted };
+    if (auto foundAlias = gTextureAliases.find(alias); foundAlias != gTextureAliases.end()) {
+        return foundAlias->second;
+    }
+
+    auto path = "MAPS\\" + fileName;
+    if (!Vfs::hasFile(path)) {
+        Logger::get().error("VFS unable to get file {}", path);
+        return nullptr;
+    }
+
+    //NOTE: init new texture, fetch & decode is done by workers
+    //upload by updateStreaming on render thread
+    auto newTexture                 = new Texture();
+    newTexture->mTextureName        = fileName;
+    newTexture->mUseTransparencyKey = useTransparencyKey;
+    newTexture->mHasMipmaps         = mipmaps;
+    newTexture->mIsPaletted         = paletted;
+    gTextureAliases[alias]          = newTexture;
+
+    if (gStreaming.pendingCount++ == 0) {
+        gStreaming.statsAtStart = gStats;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(gStreaming.mutex);
+        if (gStreaming.workers.empty()) {
+            const auto workersCount = std::clamp(std::thread::hardware_concurrency(), 2u, 5u) - 1;
+            for (unsigned int i = 0; i < workersCount; i++) {
+                gStreaming.workers.emplace_back(&Texture::workerLoop);
+            }
+        }
+
+        gStreaming.toDecode.push_back(newTexture);
+    }
+
+    gStreaming.wakeUp.notify_one();
+    return newTexture;
+}
+
+void Texture::workerLoop() {
+    for (;;) {
+        Texture* texture = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(gStreaming.mutex);
+            gStreaming.wakeUp.wait(lock, [] { return gStreaming.stop || !gStreaming.toDecode.empty(); });
+            if (gStreaming.stop) return;
+
+            texture = gStreaming.toDecode.front();
+            gStreaming.toDecode.pop_front();
+        }
+
+        //NOTE: resident textures are here only for mip residency change
+        if (texture->mState == State::Queued) {
+            texture->decode();
+        } else {
+            texture->resample();
+        }
+
+        std::lock_guard<std::mutex> lock(gStreaming.mutex);
+        gStreaming.toUpload.push_back(texture);
+    }
+}
+
+void Texture::decode() {
+    auto textureFile = Vfs::getFile("MAPS\\" + mTextureName);
+    if (!textureFile.has_value()) {
+        mState = State::Failed;
+        return;
+    }
+
+    mContentHash = hashContent(textureFile.value());
+    if (mIsPaletted) {
+        mPalette = new uint8_t[PaletteSize];
+        mBuffer = loadIndexedBMP(textureFile.value(), &mWidth, &mHeight, mPalette, mUseTransparencyKey);
+
+        //NOTE: 24 bit or unaligned source, fall back to RGBA
+        if (mBuffer == nullptr) {
+            delete[] mPalette;
+            mPalette = nullptr;
+            mIsPaletted = false;
+            textureFile.value().seek(0);
+        }
+    }
+
+    if (mBuffer == nullptr) {
+        mBuffer = loadBMP(textureFile.value(), &mWidth, &mHeight, mUseTransparencyKey);
+    }
+    if (mBuffer == nullptr) {
+        mState = State::Failed;
+        return;
+    }
+
+    //NOTE: start with low mip as placeholder, residency upgrades it once it's seen
+    mPendingMip = getCoarsestMip();
+    resample();
+    mState = State::Decoded;
+}
+
+void Texture::resample() {
+    mMipBuffer = downsample(mBuffer, mWidth, mHeight, mPendingMip);
+}
+
+void Texture::upload() {
+    if (mState == State::Decoded) {
+        //NOTE: same content under different name, share owner's GPU image
+        const TextureKey key { mContentHash, mUseTransparencyKey, mHasMipmaps, mIsPaletted };
+        if (auto foundTexture = gTextureCache.find(key); foundTexture != gTextureCache.end()) {
+            mOwner = foundTexture->second;
+            delete[] mBuffer;
+            mBuffer = nullptr;
+            delete[] mMipBuffer;
+            mMipBuffer = nullptr;
+            delete[] mPalette;
+            mPalette = nullptr;
+            gStats.texturesDeduped++;
+            gStats.textureBytesDeduped += getSizeInBytes();
+            mState = State::Resident;
+            return;
+        }
+
+        gTextureCache[key] = this;
+        mLastNeededFrame = gStreaming.frameIdx;
+    } else {
+        //NOTE: residency change, swap image for one with different top mip
+        Renderer::destroyTexture(mTextureHandle);
+        gStats.textureBytesInUse -= getSizeInBytes(mResidentMip);
+        gStreaming.pendingResidencyCount--;
+    }
+
+    if (mIsPaletted) {
+        mTextureHandle = Renderer::createIndexedTexture(mBuffer, mWidth, mHeight);
+        mPaletteHandle = Renderer::createTexture(mPalette, 256, 1);
+
+        //NOTE: paletted textures never change residency, CPU copy is not needed anymore
+        delete[] mBuffer;
+        mBuffer = nullptr;
+        delete[] mPalette;
+        mPalette = nullptr;
+    } else {
+        auto* pixels = mMipBuffer != nullptr ? mMipBuffer : mBuffer;
+        mTextureHandle = Renderer::createTexture(pixels, std::max(mWidth >> mPendingMip, 1), std::max(mHeight >> mPendingMip, 1), mHasMipmaps);
+    }
+    mResidentMip = mPendingMip;
+    gStats.textureBytesInUse += getSizeInBytes(mResidentMip);
+
+    delete[] mMipBuffer;
+    mMipBuffer = nullptr;
+    mResidencyInFlight = false;
+    mState = State::Resident;
+}
+
+void Texture::updateStreaming() {
+    const bool wasStreaming = gStreaming.pendingCount > 0;
+
+    //NOTE: at least one texture goes through every frame even if it's bigger than budget
+    size_t uploadedBytes = 0;
+    while (uploadedBytes < gStreaming.uploadBudget) {
+        Texture* texture = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(gStreaming.mutex);
+            if (gStreaming.toUpload.empty()) break;
+            texture = gStreaming.toUpload.front();
+            gStreaming.toUpload.pop_front();
+        }
+
+        if (texture->mState != State::Resident) {
+            gStreaming.pendingCount--;
+        }
+
+        if (texture->mState == State::Failed) {
+            Logger::get().error("unable to decode texture: {}", texture->getName());
+            continue;
+        }
+
+        texture->upload();
+        if (texture->mOwner == nullptr) {
+            uploadedBytes += texture->getSizeInBytes(texture->mResidentMip);
+        }
+    }
+
+    //NOTE: report how much memory content dedup saved for this batch ( mission )
+    if (wasStreaming && gStreaming.pendingCount == 0) {
+        const auto& before = gStreaming.statsAtStart;
+        Logger::get().info("textures streamed in: {} KB resident, {} KB saved by dedup ({} shared)",
+            gStats.textureBytesInUse / 1024,
+            (gStats.textureBytesDeduped - before.textureBytesDeduped) / 1024,
+            gStats.texturesDeduped - before.texturesDeduped);
+    }
+
+    updateResidency();
 }
 
-Texture* Texture::loadFromFile(const std::string& fileName, bool useTransparencyKey, bool mipmaps) {
-    auto* texture = gTextureCache[fileName];
-    if (texture == nullptr) {
-        auto path = "MAPS\\" + fileName;   
-        auto textureFile = Vfs::getFile(path);
-        if (textureFile.has_value()) {
-            //NOTE: init new texture
-            auto newTexture             = new Texture();
-            newTexture->mTextureName    = fileName;
-            newTexture->mBuffer         = loadBMP(textureFile.value(), &newTexture->mWidth, &newTexture->mHeight, useTransparencyKey);
-          
-            if (!newTexture->mBuffer)
-                return {};
+void Texture::updateResidency() {
+    const auto frame = gStreaming.frameIdx++;
+
+    struct Candidate {
+        Texture* texture;
+        int desiredMip;
+        size_t desiredBytes() const { return texture->getSizeInBytes(desiredMip); }
+    };
 
-            newTexture->mTextureHandle = Renderer::createTexture(newTexture->mBuffer, newTexture->mWidth, newTexture->mHeight, mipmaps);
-            return gTextureCache[fileName] = newTexture;
+    //NOTE: pick wanted top mip for every GPU image based on requests from last frame
+    static std::vector<Candidate> candidates;
+    candidates.clear();
+
+    size_t totalBytes = 0;
+    for (auto& [key, texture] : gTextureCache) {
+        if (texture->mState != State::Resident) continue;
+
+        auto desiredMip = texture->mResidentMip;
+        const bool wasSeen = texture->mLastRequestedFrame == frame;
+        if (wasSeen && texture->mRequestedMip < desiredMip) {
+            desiredMip = texture->mRequestedMip;
+        } else if (wasSeen && frame - texture->mLastNeededFrame > ResidencyHysteresisFrames) {
+            desiredMip = texture->mRequestedMip;
+        } else if (!wasSeen && frame - texture->mLastRequestedFrame > ResidencyHysteresisFrames) {
+            desiredMip = texture->getCoarsestMip();
         }
+
+        candidates.push_back({ texture, desiredMip });
+        totalBytes += candidates.back().desiredBytes();
+    }
+
+    //NOTE: over budget, drop top mip of biggest textures first
+    const auto smallerFirst = [](const Candidate& a, const Candidate& b) { return a.desiredBytes() < b.desiredBytes(); };
+    std::make_heap(candidates.begin(), candidates.end(), smallerFirst);
+    auto heapEnd = candidates.end();
+    while (totalBytes > gStreaming.residencyBudget && heapEnd != candidates.begin()) {
+        std::pop_heap(candidates.begin(), heapEnd, smallerFirst);
+        auto& biggest = *(heapEnd - 1);
+        if (biggest.desiredMip >= biggest.texture->getCoarsestMip()) {
+            heapEnd--;
+            continue;
+        }
+
+        totalBytes -= biggest.desiredBytes();
+        biggest.desiredMip++;
+        totalBytes += biggest.desiredBytes();
+        std::push_heap(candidates.begin(), heapEnd, smallerFirst);
+    }
+
+    //NOTE: workers rebuild image from CPU copy, upload goes through streaming budget
+    size_t scheduled = 0;
+    {
+        std::lock_guard<std::mutex> lock(gStreaming.mutex);
+        for (auto& candidate : candidates) {
+            auto* texture = candidate.texture;
+            if (candidate.desiredMip == texture->mResidentMip || texture->mResidencyInFlight) continue;
+            if (scheduled++ >= MaxResidencyJobsPerFrame) break;
+
+            texture->mResidencyInFlight = true;
+            texture->mPendingMip = candidate.desiredMip;
+            gStreaming.pendingResidencyCount++;
+            gStreaming.toDecode.push_back(texture);
+        }
+    }
+
+    if (scheduled > 0) {
+        gStreaming.wakeUp.notify_all();
+    }
+}
+
+void Texture::requestScreenSize(float pixels) {
+    auto* owner = getOwner();
+    if (owner->mState != State::Resident) return;
+
+    const auto texels = static_cast<float>(std::max(owner->mWidth, owner->mHeight));
+    const auto mip = std::clamp(static_cast<int>(std::floor(std::log2(texels / std::max(pixels, 1.0f)))), 0, owner->getCoarsestMip());
+
+    if (owner->mLastRequestedFrame != gStreaming.frameIdx) {
+        owner->mLastRequestedFrame = gStreaming.frameIdx;
+        owner->mRequestedMip = mip;
+    } else {
+        owner->mRequestedMip = std::min(owner->mRequestedMip, mip);
+    }
+
+    if (mip <= owner->mResidentMip) {
+        owner->mLastNeededFrame = gStreaming.frameIdx;
+    }
+}
+
+void Texture::setUploadBudget(size_t bytesPerFrame) {
+    gStreaming.uploadBudget = bytesPerFrame;
+}
+
+void Texture::setResidencyBudget(size_t bytes) {
+    gStreaming.residencyBudget = bytes;
+}
+
+size_t Texture::getResidencyBudget() {
+    return gStreaming.residencyBudget;
+}
+
+size_t Texture::getPendingCount() {
+    return gStreaming.pendingCount;
+}
+
+size_t Texture::getPendingResidencyCount() {
+    return gStreaming.pendingResidencyCount;
+}
+
+std::optional<Renderer::TextureHandle> Texture::getResidentHandle() const {
+    if (mState == State::Resident) {
+        return getOwner()->mTextureHandle;
     }
 
-    return texture;
+    return std::nullopt;
+}
+
+std::optional<Renderer::TextureHandle> Texture::getResidentPaletteHandle() const {
+    if (mState == State::Resident && getOwner()->mIsPaletted) {
+        return getOwner()->mPaletteHandle;
+    }
+
+    return std::nullopt;
+}
+
+void Texture::setPalettedEnabled(bool enabled) {
+    gPalettedEnabled = enabled;
+}
+
+bool Texture::isPalettedEnabled() {
+    return gPalettedEnabled;
+}
+
+int Texture::getCoarsestMip() const {
+    //NOTE: indices can't be downsampled, paletted textures stay at full size
+    if (mIsPaletted) return 0;
+
+    int mip = 0;
+    while (std::max(mWidth >> mip, mHeight >> mip) > MinResidentSize) {
+        mip++;
+    }
+    return mip;
+}
+
+size_t Texture::getSizeInBytes() const {
+    return getSizeInBytes(0);
+}
+
+size_t Texture::getSizeInBytes(int mip) const {
+    if (mIsPaletted) {
+        return static_cast<size_t>(mWidth) * static_cast<size_t>(mHeight) + PaletteSize;
+    }
+
+    const auto baseSize = static_cast<size_t>(std::max(mWidth >> mip, 1)) * static_cast<size_t>(std::max(mHeight >> mip, 1)) * 4;
+    //NOTE: full mip chain adds roughly one third
+    return mHasMipmaps ? baseSize + baseSize / 3 : baseSize;
 }
 
 void Texture::bind(unsigned int slot) const {
-    Renderer::bindTexture(mTextureHandle, slot);
+    Renderer::bindTexture(getTextureHandle(), slot);
 }
 
 void Texture::release() {
-    Renderer::destroyTexture(mTextureHandle);
+    if (mState == State::Resident && mOwner == nullptr) {
+        Renderer::destroyTexture(mTextureHandle);
+        if (mIsPaletted) {
+            Renderer::destroyTexture(mPaletteHandle);
+        }
+        gStats.textureBytesInUse -= getSizeInBytes(mResidentMip);
+    }
+
     if (mBuffer != nullptr) {
-        delete mBuffer;
+        delete[] mBuffer;
         mBuffer = nullptr;
     }
-}
+
+    delete[] mMipBuffer;
+    mMipBuffer = nullptr;
+    delete[] mPalette;
+    mPalette = nullptr;
+}
\ No newline at end of file
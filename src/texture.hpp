@@ -1,24 +1,78 @@
 #pragma once
 #include <string>
+#include <atomic>
+#include <optional>
 #include "renderer.hpp"
 #include "stats.hpp"
 
 class Texture {
 public:
+    enum class State { Queued, Decoded, Resident, Failed };
+
     Texture() { gStats.texturesInUse++; }
     ~Texture() { release(); gStats.texturesInUse--; }
     static void clearCache();
-    static Texture* loadFromFile(const std::string& path, bool useTransparencyKey = false, bool mipmaps = false);
+    static Texture* loadFromFile(const std::string& path, bool useTransparencyKey = false, bool mipmaps = false, bool paletted = false);
+
+    //NOTE: default for materials, paletted textures stay R8 indices + 256x1 palette on GPU
+    static void setPalettedEnabled(bool enabled);
+    static bool isPalettedEnabled();
+
+    //NOTE: called once per frame on render thread, uploads decoded textures
+    //until per frame byte budget is exhausted and schedules mip residency changes
+    static void updateStreaming();
+    static void setUploadBudget(size_t bytesPerFrame);
+    static void setResidencyBudget(size_t bytes);
+    static size_t getResidencyBudget();
+    static size_t getPendingCount();
+    static size_t getPendingResidencyCount();
+
     void bind(unsigned int slot) const;
     const std::string& getName() const { return mTextureName; }
     int getWidth() const { return mWidth; }
     int getHeight() const { return mHeight; }
-    Renderer::TextureHandle getTextureHandle() const { return mTextureHandle; }
+    size_t getSizeInBytes() const;
+    size_t getSizeInBytes(int mip) const;
+    bool isResident() const { return mState == State::Resident; }
+    bool isFailed() const { return mState == State::Failed; }
+    bool isPaletted() const { return getOwner()->mIsPaletted; }
+    int getResidentMip() const { return getOwner()->mResidentMip; }
+    Renderer::TextureHandle getTextureHandle() const { return getOwner()->mTextureHandle; }
+
+    //NOTE: empty until texture is streamed in, renderer binds placeholder instead
+    std::optional<Renderer::TextureHandle> getResidentHandle() const;
+    std::optional<Renderer::TextureHandle> getResidentPaletteHandle() const;
+
+    //NOTE: texture is seen this frame covering roughly this many pixels on screen
+    void requestScreenSize(float pixels);
 private:
+    static void workerLoop();
+    static void updateResidency();
+    const Texture* getOwner() const { return mOwner != nullptr ? mOwner : this; }
+    Texture* getOwner() { return mOwner != nullptr ? mOwner : this; }
+    int getCoarsestMip() const;
+    void decode();
+    void resample();
+    void upload();
     void release();
     uint8_t* mBuffer{nullptr};
+    uint8_t* mMipBuffer{nullptr};
+    uint8_t* mPalette{nullptr};
+    Texture* mOwner{nullptr};
     std::string mTextureName;
     Renderer::TextureHandle mTextureHandle{0};
+    Renderer::TextureHandle mPaletteHandle{0};
+    std::atomic<State> mState{State::Queued};
+    uint64_t mContentHash = 0;
+    uint64_t mLastRequestedFrame = 0;
+    uint64_t mLastNeededFrame = 0;
     int mWidth = 0;
     int mHeight = 0;
+    int mResidentMip = 0;
+    int mPendingMip = 0;
+    int mRequestedMip = 0;
+    bool mResidencyInFlight = false;
+    bool mUseTransparencyKey = false;
+    bool mHasMipmaps = false;
+    bool mIsPaletted = false;
 };
\ No newline at end of file
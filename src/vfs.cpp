@@ -4,11 +4,13 @@
 
 #include <filesystem>
 #include <map>
+#include <mutex>
 
 struct DtaFileEntry 
 {
     std::shared_ptr<std::ifstream> file;
     std::shared_ptr<MFFormat::DataFormatDTA> parser;
+    std::shared_ptr<std::mutex> mutex;
     uint32_t fleIdx;
 };
 
@@ -51,6 +53,8 @@ void Vfs::init(const std::string& rootDir) {
     for(const auto& dtaFile : mFilesToFetchVer2) {    
         auto filePathToOpen = rootDir + dtaFile.fileName;
         auto dtaFileSteam = std::make_shared<std::ifstream>(filePathToOpen, std::ifstream::binary);
+        //NOTE: one lock per DTA, textures are fetched from worker threads
+        auto dtaFileMutex = std::make_shared<std::mutex>();
         if(dtaFileSteam->good()) {
             auto currentDtaParser = std::make_shared<MFFormat::DataFormatDTA >();
             currentDtaParser->setDecryptKeys(dtaFile.fileKey1, dtaFile.fileKey2);
@@ -74,6 +78,7 @@ void Vfs::init(const std::string& rootDir) {
                     gFileMap[hasher(fileName)] = { 
                         dtaFileSteam,
                         currentDtaParser,
+                        dtaFileMutex,
                         i
                     };
                 }
@@ -95,8 +100,9 @@ std::optional<MFUtil::ScopedBuffer> Vfs::getFile(const std::string& filePath) {
     auto lowerFilePath = MFUtil::strToLower(filePath);
     const auto fileHash = hasher(lowerFilePath);
 
-    if(gFileMap.find(fileHash) != gFileMap.end()) {
-        DtaFileEntry& entry = gFileMap[fileHash];
+    if(auto foundEntry = gFileMap.find(fileHash); foundEntry != gFileMap.end()) {
+        DtaFileEntry& entry = foundEntry->second;
+        std::lock_guard<std::mutex> lock(*entry.mutex);
         return entry.parser->getFile(*entry.file, entry.fleIdx);
     }
 
@@ -104,6 +110,11 @@ std::optional<MFUtil::ScopedBuffer> Vfs::getFile(const std::string& filePath) {
     return {};
 }
 
+bool Vfs::hasFile(const std::string& filePath) {
+    std::hash<std::string> hasher;
+    return gFileMap.find(hasher(MFUtil::strToLower(filePath))) != gFileMap.end();
+}
+
 void Vfs::destroy() {
     gFileMap.clear();
 }
\ No newline at end of file
@@ -9,6 +9,7 @@ class Vfs {
 public:
     static void init(const std::string& rootDir);
     static std::optional<MFUtil::ScopedBuffer> getFile(const std::string& filePath);
+    static bool hasFile(const std::string& filePath);
     static std::vector<std::string>& getMissionsList(); 
     static void destroy();
 };
\ No newline at end of file